@@ -64,8 +64,18 @@ extern void vAssertCalled( void );
                                                                                         // the longest period we will be able to measure (= the maximum time a task can be delayed or blocked) is 4294967295 ticks long.
                                                                                         // using 32 bits is the best choice performance-wise for a 32-bit processor such as ours.
 #define configIDLE_SHOULD_YIELD                          1
+#if ( mainCOROUTINES_DEMO == 1 )
+    #define configUSE_CO_ROUTINES                        1
+    #define configMAX_CO_ROUTINE_PRIORITIES              ( 8 )        // Priorities of the co-routine jobs, all of them below the tasks
+#else
+    #define configUSE_CO_ROUTINES                        0
+#endif
 
-#define configMAX_PRIORITIES                             ( 10 )
+#if ( mainBENCHMARK_DEMO == 1 )
+    #define configMAX_PRIORITIES                         ( 260 )     // The benchmark gives a different priority to each of up to 256 periodic tasks
+#else
+    #define configMAX_PRIORITIES                         ( 10 )
+#endif
 #define configTIMER_QUEUE_LENGTH                         20
 #define configTIMER_TASK_PRIORITY                        ( configMAX_PRIORITIES - 1 )
 #define configUSE_COUNTING_SEMAPHORES                    1
@@ -1,4 +1,16 @@
 #include "../RealTimeScheduler.h"
+#if( configENABLE_GENERATOR == 1 || configENABLE_PROFILING == 1 )
+    #include <math.h>
+#endif
+#if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+    #include "queue.h"
+#endif
+#if( configENABLE_COROUTINES == 1 )
+    #if( configUSE_CO_ROUTINES == 0 )
+        #error "The co-routine jobs need configUSE_CO_ROUTINES set to 1 in FreeRTOSConfig.h"
+    #endif
+    #include "croutine.h"
+#endif
 
 /**
  * Custom Task Control Block for handling Periodic Tasks
@@ -28,11 +40,166 @@ typedef struct tskCustomTaskControlBlock{
     #endif
 
     #if( configENABLE_EDF == 1 )
-        TickType_t xAbsDeadline;    // Absolute deadline computed by the kernel
+        uint64_t ullAbsDeadline;    // Absolute deadline on the 64-bit time base (never wraps)
+    #endif
+
+    #if( configENABLE_SLACK_STEALING == 1 )
+        TickType_t xJobRelease;     // Release time of the current job (of the next one once completed)
+    #endif
+
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        BaseType_t xThreshold;      // Once started, the job is preempted only by priorities above it
+        UBaseType_t uxGroup;        // Non-preemptive group whose task (and stack) executes the jobs
+        UBaseType_t uxPendingJobs;  // Jobs released and not completed yet
+        TickType_t xNextRelease;    // Release time of the next job
+    #endif
+
+    #if( configENABLE_SRP == 1 || configENABLE_LIMITED_PREEMPTION == 1 )
+        TickType_t xBlocking;                       // Longest critical section or non-preemptive region of a lower level task (B_i)
+    #endif
+
+    #if( configENABLE_SRP == 1 )
+        BaseType_t xPreemptionLevel;                // Static level: RMS priority, EDF inverse of the deadline
+        TickType_t xCSLength[ configMAX_RESOURCES ];// Longest critical section on each resource (0 if unused)
+    #endif
+
+    #if( configENABLE_MIXED_CRITICALITY == 1 )
+        BaseType_t xCriticality;    // CRITICALITY_LO or CRITICALITY_HI
+        TickType_t xWCETHigh;       // WCET of HI criticality tasks in HI mode (xWCET is the LO budget)
+    #endif
+
+    #if( configENABLE_MK_FIRM == 1 )
+        UBaseType_t uxM;            // At least m jobs ...
+        UBaseType_t uxK;            // ... out of any k consecutive ones must meet their deadline
+        UBaseType_t uxJobIndex;     // Index of the current job in the (m,k) pattern
+        uint32_t ulHistory;         // Outcome of the last k jobs, bit 0 is the most recent (1 if met)
+        BaseType_t xOptional;       // Flag set while an optional job runs (aborted at its deadline)
+        BaseType_t xAborted;        // Flag set once the optional job reached its deadline (until given up or restarted)
+    #endif
+
+    #if( configENABLE_PROFILING == 1 )
+        TickType_t xWCETProfiled;   // WCET suggested by the profiling (pWCET at configPROF_EXCEEDANCE)
+    #endif
+
+    #if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+        QueueHandle_t xArrivalQueue;    // Arrival times of the jobs not released yet (NULL if periodic)
+    #endif
+
+    #if( configENABLE_SPORADIC == 1 )
+        TickType_t xLastArrival;        // Time of the last arrival accepted
+        UBaseType_t uxArrivals;         // Arrivals accepted so far
+        UBaseType_t uxRejected;         // Arrivals rejected since the last job started
+    #endif
+
+    #if( configENABLE_CHAINS == 1 )
+        struct tskCustomTaskControlBlock *pxTrigger;    // Task whose completed jobs release the jobs (NULL if time-triggered)
+        UBaseType_t uxChainDepth;                       // Longest path from a chain head (RMS ties are broken by it)
+    #endif
+
+    #if( configENABLE_PARTITIONS == 1 )
+        UBaseType_t uxPartition;    // Partition whose budget the jobs consume
+    #endif
+
+    #if( configENABLE_LIMITED_PREEMPTION == 1 )
+        TickType_t xNPRLength;      // Longest non-preemptive region the higher priority tasks tolerate (Q_i)
+        TickType_t xNPRTime;        // Time spent in the current non-preemptive region
+        BaseType_t xInNPR;          // Flag set while the job can not be preempted
+        UBaseType_t uxPreemptions;  // Jobs preempted in the current hyperperiod
+    #endif
+
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        BaseType_t xSoft;           // Flag set if the task has no guarantee and runs between the two bands of the hard tasks
+        BaseType_t xLowPriority;    // Priority of the hard jobs until their promotion (xPriority afterwards)
+        TickType_t xPromotion;      // Promotion time from the release (D - R)
+        TickType_t xNextPromotion;  // Time of the next promotion
+    #endif
+
+    #if( configENABLE_LET == 1 )
+        BaseType_t xLETDone;        // Flag set once the job released last has completed (its outputs can be published)
+    #endif
+
+    #if( configENABLE_ELASTIC == 1 )
+        TickType_t xPeriodMin;      // Nominal period given at creation (the shortest one)
+        TickType_t xPeriodMax;      // Longest period accepted by the task
+        UBaseType_t uxElasticity;   // Share of the overload taken by the task (0 if rigid)
+        TickType_t xPeriodNext;     // Period found by the last compression, applied at the next job boundary
+        TickType_t xWCETNext;       // WCET given at runtime, a heavier one is used once no period is still to stretch
+        BaseType_t xImplicitDeadline;   // Flag set if the deadline follows the period (D = T at creation)
+        BaseType_t xElasticFixed;   // Flag set while compressing once the period can not change anymore
+    #endif
+
+    #if( configENABLE_OVERLOAD == 1 )
+        UBaseType_t uxValue;        // Value gained by every job completed in time
+        TickType_t xTolerance;      // Lateness still accepted after the deadline (the job keeps its value)
+        BaseType_t xRejected;       // Flag set if the pending job has been rejected by the overload manager
     #endif
 
 }cTCB_t;
 
+/**
+ * Resource Control Block for the Stack Resource Policy
+ */
+#if( configENABLE_SRP == 1 )
+    typedef struct tskResourceControlBlock{
+        BaseType_t xCeiling;        // Highest preemption level among the tasks using the resource
+        BaseType_t xSaved;          // Priority of the holder (RMS) or system ceiling (EDF) before the resource was taken
+    } cRCB_t;
+#endif
+
+/**
+ * Group of tasks that can never preempt each other, sharing one FreeRTOS task (and stack)
+ */
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+    typedef struct tskThresholdGroup{
+        TaskHandle_t xHandle;               // Task executing the jobs of every member
+        cTCB_t *pxRunning;                  // Member whose job has started (NULL if none)
+        BaseType_t xPriority;               // Priority of the highest priority member
+        UBaseType_t ulStackDepth;           // Largest stack depth among the members
+        char cName[ configMAX_TASK_NAME_LEN ];
+    } cGroup_t;
+#endif
+
+/**
+ * Chain of tasks passing data to each other (cause-effect chain)
+ */
+#if( configENABLE_CHAINS == 1 )
+    typedef struct tskChainControlBlock{
+        const char *pcName;                         // Pointer to the descriptive name for the chain
+        TickType_t xDeadline;                       // End-to-end deadline on the latency (0 if none)
+        UBaseType_t uxLength;                       // Number of stages
+        cTCB_t *pxStages[ configMAX_CHAIN_LENGTH ]; // Stages from the head (reading the input) to the tail
+    } cChain_t;
+#endif
+
+/**
+ * Partition of tasks served by a periodic resource (budget Theta every period Pi)
+ */
+#if( configENABLE_PARTITIONS == 1 )
+    typedef struct tskPartitionControlBlock{
+        cTCB_t xServer;                         // Reservation as a periodic task of the global RMS (WCET Theta, period Pi)
+        TickType_t xRemaining;                  // Budget left in the current period
+        TickType_t xNextReplenish;              // Time of the next replenishment
+        BaseType_t xExhausted;                  // Flag set while the tasks of the partition run in background
+        UBaseType_t uxTasks;                    // Number of tasks of the partition
+        TaskHandle_t xIdleHandle;               // Task consuming the budget while no job of the partition is ready
+        char cIdleName[ configMAX_TASK_NAME_LEN ];
+    } cPartition_t;
+#endif
+
+/**
+ * Scheduling policy selected at runtime, hosted by the Task List and the Scheduler Task of EDF
+ */
+#if( configENABLE_POLICY_SELECT == 1 )
+    typedef struct tskSchedulingPolicy{
+        const char *pcName;                             // Name printed at the start and by the benchmark
+        TickType_t ( *pxGetKey )( cTCB_t *pxTCB );      // Key sorting the Task List from the highest priority
+        void ( *pxAssignPriorities )();                 // Priorities set before the start (NULL keeps the ones given)
+        BaseType_t ( *pxCheckBound )( List_t *pxList ); // Utilisation bound of the policy (NULL if no guarantee)
+        const char *pcBound;                            // Printed when the bound is exceeded
+        BaseType_t xDynamic;                            // Flag to update the priorities at every job
+    } cPolicy_t;
+#endif
+
 /**
  * Custom Task Control Block for handling Aperiodic Tasks
  */
@@ -44,14 +211,67 @@ typedef struct tskCustomTaskControlBlock{
         TickType_t xWCET;               // Worst-Case-Time-Execution
         ListItem_t pxTCBAItem;          // Item object for task list (owner)
         BaseType_t xArrival;            // Arrival Time used as key for sorting the queue
+        #if( configENABLE_FIRM_APERIODIC == 1 )
+            uint64_t ullAbsDeadline;    // Absolute deadline of a firm job: key of the deadline queue
+        #endif
     } cTCBA_t;
 #endif
 
+/**
+ * Budget left unused by a job completed before its WCET (residual capacity of CASH)
+ */
+#if( configENABLE_RECLAIMING == 1 )
+    typedef struct tskCapacityControlBlock{
+        TickType_t xCapacity;           // Ticks left to use
+        TickType_t xDeadline;           // Absolute deadline of the job: the capacity expires there
+        BaseType_t xPriority;           // Priority of the job (fixed priority policies)
+    } cCapacity_t;
+#endif
+
+/**
+ * Port of the Logical Execution Time: output of a task read by other tasks through rotated buffers
+ */
+#if( configENABLE_LET == 1 )
+    typedef struct tskLETPortControlBlock{
+        const char *pcName;                                 // Pointer to the descriptive name for the port
+        cTCB_t *pxWriter;                                   // Task publishing the port at its deadlines (NULL if not created)
+        void *pvBuffers[ configMAX_LET_BUFFERS ];           // Buffers given by the user (two for double buffering)
+        UBaseType_t uxBuffers;                              // Number of buffers
+        UBaseType_t uxPublished;                            // Buffer latched by the readers at their releases
+        UBaseType_t uxWriting;                              // Buffer written by the current job of the writer
+        TickType_t xNextRelease;                            // Next release of the writer (a buffer is handed to it)
+        TickType_t xNextPublish;                            // Deadline of the current job of the writer
+        UBaseType_t uxReaders;                              // Number of readers
+        cTCB_t *pxReaders[ configMAX_LET_READERS ];         // Tasks reading the port
+        const void *pvLatched[ configMAX_LET_READERS ];     // Buffer latched by each reader at its last release
+        TickType_t xNextLatch[ configMAX_LET_READERS ];     // Next release of each reader
+    } cLETPort_t;
+#endif
+
+/**
+ * Background work drained by the Idle Task in bounded chunks
+ */
+#if( configENABLE_BACKGROUND == 1 )
+    typedef struct tskBackgroundWorkControlBlock{
+        BackgroundChunkFunction_t pxChunkCode;  // Runs one chunk of the work, returns pdTRUE once the work is complete
+        const char *pcName;                     // Pointer to the descriptive name for the work
+        void *pvParameters;                     // Pointer to optional arguments
+        UBaseType_t uxChunks;                   // Expected number of chunks for the progress (0 if unknown)
+        UBaseType_t uxChunksDone;               // Chunks executed so far
+        TickType_t xChunkWCET;                  // Worst-Case-Time-Execution of a chunk (at most configBACKGROUND_MAX_CHUNK)
+        TickType_t xLongestChunk;               // Longest chunk measured (preemptions by the tasks included)
+        TickType_t xBusyTicks;                  // Ticks elapsed in the chunks of the work
+        TickType_t xQueued;                     // Tick count when the work has been queued
+        ListItem_t xWorkItem;                   // Item object for the background queue (owner)
+    } cWork_t;
+#endif
+
 /**
  * ---------------------------------------------------------------------------------
  * Variables by category
  */
 static TickType_t xStartTime = 0;       // Counter time elapse since start
+static volatile uint64_t ullTickCount64 = configINITIAL_TICK_COUNT;    // Tick count extended to 64 bits by the TickHook
 static BaseType_t xIdleFlag = 0;        // Flag to know if Idle Task is active
 #if( configENABLE_RM == 1 )
     static List_t xTASK_List;           // List that contains all tasks TCBs
@@ -62,13 +282,117 @@ static BaseType_t xIdleFlag = 0;        // Flag to know if Idle Task is active
     static List_t xTASK_List_tmp;                   // Temporaly List for removing items
     static List_t *pxTASK_List = NULL;              // Pointer to task list initialization
     static List_t *pxTASK_List_tmp = NULL;          // Pointer to temp task list initialization
+    #if( configENABLE_POLICY_SELECT == 1 )
+        static const cPolicy_t *pxPolicy = NULL;   // Policy selected by vInitSchedulerPolicy
+    #endif
 #endif
 #if(configENABLE_APERIODIC == 1 )
     static BaseType_t xArrival = -1;                // Arrival time used for sorting in queue
-    static TaskHandle_t xPSHandle = NULL;           // Task handle of the Polling Server
+    #if( configENABLE_SLACK_STEALING == 0 )
+        static TaskHandle_t xPSHandle = NULL;       // Task handle of the Polling Server
+    #endif
     static List_t xAperiodicTASK_List;              // List that contains all aperiodic tasks TCBs
     static List_t *pxAperiodicTASK_List = NULL;     // Pointer to aperiodic task list initialization
 #endif
+#if( configENABLE_SLACK_STEALING == 1 )
+    static TaskHandle_t xSlackStealerHandle = NULL; // Task handle of the Slack Stealer
+#endif
+#if( configENABLE_FIRM_APERIODIC == 1 )
+    static cTCBA_t *pxFirmJobs[ configMAX_FIRM_APERIODIC ];         // Firm jobs accepted, binary min-heap on the deadline
+    static UBaseType_t uxFirmJobs = 0;                              // Number of firm jobs queued
+    static cTCBA_t *pxFirmScratch[ configMAX_FIRM_APERIODIC + 1 ];  // Copy of the queue sorted by the acceptance test
+    static UBaseType_t uxFirmAccepted = 0;                          // Firm jobs accepted so far
+    static UBaseType_t uxFirmRejected = 0;                          // Firm jobs rejected so far
+#endif
+#if( configENABLE_RECLAIMING == 1 )
+    static cCapacity_t xCapacities[ configMAX_CAPACITIES ]; // Capacities reclaimed from the early completions sorted by deadline
+    static UBaseType_t uxCapacities = 0;            // Number of capacities queued
+    static TickType_t xReclaimed = 0;               // Ticks reclaimed so far
+    static TickType_t xReclaimedUsed = 0;           // Ticks of them used by the Polling Server
+    static TaskHandle_t xBudgetHandle = NULL;       // Task handle of the Budget Task suspending the exhausted Polling Server
+    static cTCB_t *pxExhaustedServer = NULL;        // Polling Server out of budget and capacities (NULL if none)
+#endif
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+    static TaskHandle_t xReleaseHandle = NULL;      // Task handle of the job Release Task
+    static cGroup_t xGroups[ configMAX_PRIORITIES ];// Non-preemptive groups (at most one per priority)
+    static UBaseType_t uxGroups = 0;                // Number of non-preemptive groups
+#endif
+#if( configENABLE_SRP == 1 )
+    static cRCB_t xResources[ configMAX_RESOURCES ];    // Resources shared by the periodic tasks
+    #if( configENABLE_EDF == 1 )
+        static BaseType_t xSystemCeiling = -1;          // Highest ceiling among the taken resources (-1 if none)
+    #endif
+#endif
+#if( configENABLE_MIXED_CRITICALITY == 1 )
+    static TaskHandle_t xModeSwitchHandle = NULL;   // Task handle of the criticality Mode Switch Task
+    static BaseType_t xCriticalityMode = CRITICALITY_LO;    // Current criticality mode of the system
+    static cTCB_t *pxOverrunTask = NULL;            // HI task whose LO budget overrun caused the mode switch
+#endif
+#if( configENABLE_MK_FIRM == 1 )
+    static TaskHandle_t xAbortHandle = NULL;        // Task handle of the Abort Task restarting the late optional jobs
+    static UBaseType_t uxOptionalPriority = tskIDLE_PRIORITY;  // Top of the band of the optional jobs, below the mandatory ones
+#endif
+#if( configENABLE_OVERHEADS == 1 )
+    static uint32_t ulCyclesPerTick = 1;            // Cycles between two tick interrupts
+    static uint32_t ulOverheadTick = 0;             // Cycles spent by each tick interrupt (SysTick ISR and TickHook)
+    static uint32_t ulOverheadSwitch = 0;           // Cycles spent by a preemption (context switch in and out)
+    static uint32_t ulOverheadScheduler = 0;        // Cycles spent by an activation of the EDF scheduler task
+    static TaskHandle_t xCalibrationSwitchHandle = NULL;    // Task handle of the task preempting the Calibration Task
+#endif
+#if( configENABLE_CHAINS == 1 )
+    static cChain_t xChains[ configMAX_CHAINS ];    // Cause-effect chains (empty if not created)
+#endif
+#if( configENABLE_SPORADIC == 1 )
+    static cTCB_t *pxSporadicTCBs[ configMAX_SPORADIC ];    // TCBs of the sporadic tasks (looked up from the ISRs)
+    static UBaseType_t uxSporadicTasks = 0;                 // Number of sporadic tasks
+#endif
+#if( configENABLE_PARTITIONS == 1 )
+    static cPartition_t xPartitions[ configMAX_PARTITIONS ];    // Partitions (empty if not created)
+    static List_t xPartition_List;                              // Reservations sorted by period (global RMS priority)
+    static TaskHandle_t xPartitionsHandle = NULL;               // Task handle of the Partitions Task (budget enforcement)
+#endif
+#if( configENABLE_DUAL_PRIORITY == 1 )
+    static TaskHandle_t xPromotionHandle = NULL;                // Task handle of the Promotion Task
+#endif
+#if( configENABLE_LIMITED_PREEMPTION == 1 )
+    static TaskHandle_t xNPRHandle = NULL;          // Task handle of the NPR Task (region enforcement)
+    static const BaseType_t xNPRCeiling = configSCHED_PRIO - 1;    // Priority of the jobs inside a non-preemptive region
+    static TickType_t xHyperperiod = 0;             // Hyperperiod of the task set (the preemptions are reported every one)
+    static TickType_t xNextReport = 0;              // End of the current hyperperiod
+    static UBaseType_t uxPreemptions = 0;           // Jobs preempted in the current hyperperiod
+#endif
+#if( configENABLE_COROUTINES == 1 )
+    static List_t xCoRoutine_List;                  // Co-routine jobs sorted by deadline (deadline monotonic priority)
+#endif
+#if( configENABLE_LET == 1 )
+    static cLETPort_t xLETPorts[ configMAX_LET_PORTS ];  // Ports of the Logical Execution Time (empty if not created)
+#endif
+#if( configENABLE_OVERLOAD == 1 )
+    static UBaseType_t uxValueAchieved = 0;         // Cumulative value of the jobs completed in time
+    static UBaseType_t uxValueMissed = 0;           // Value lost by the jobs completed late
+    static UBaseType_t uxValueRejected = 0;         // Value lost by the jobs rejected
+    static UBaseType_t uxJobsRejected = 0;          // Jobs rejected by the overload manager
+#endif
+#if( configENABLE_BACKGROUND == 1 )
+    static List_t xBackground_List;                 // Background works served round robin by the Idle Task
+    static UBaseType_t uxBackgroundCompleted = 0;   // Background works completed
+    static UBaseType_t uxBackgroundChunks = 0;      // Chunks executed by the Idle Task
+    static TickType_t xBackgroundTicks = 0;         // Idle ticks recovered by the chunks
+#endif
+#if( configENABLE_BENCHMARK == 1 )
+    static TaskHandle_t xBenchmarkHandle = NULL;                                    // Task handle of the benchmark task
+    static TaskHandle_t xBenchTaskHandles[ configBENCH_MAX_TASKS ];                 // Task handles of the measured task set
+    static char cBenchTaskNames[ configBENCH_MAX_TASKS ][ configMAX_TASK_NAME_LEN ];// Unique names of the measured task set
+#endif
+#if( configENABLE_GENERATOR == 1 )
+    static uint32_t ulGenSeed = configGEN_SEED;         // State of the pseudo-random generator
+    static cTCB_t xGenTCBs[ configGEN_TASKS ];          // TCBs of the generated task set
+    static List_t xGenTASK_List;                        // Generated task set sorted by period (RMS priority)
+#endif
+#if( configENABLE_MULTICORE == 1 )
+    static cTCB_t xCoreTCBs[ configMULTICORE_MAX_TASKS ];       // Copies of the periodic tasks moved between the cores
+    static List_t xCore_Lists[ configMULTICORE_MAX_CORES ];     // Tasks assigned to each core sorted by period (RMS priority)
+#endif
 /**
  * ---------------------------------------------------------------------------------
  */
@@ -78,10 +402,22 @@ static BaseType_t xIdleFlag = 0;        // Flag to know if Idle Task is active
  * Declaration Functions by category
  */
 static void prvCallTaskCreate();
-static void prvPeriodicTaskMaster( void *pvParameters );
+#if( configENABLE_PREEMPTION_THRESHOLD == 0 )
+    static void prvPeriodicTaskMaster( void *pvParameters );
+#endif
+static void prvJobEntry( cTCB_t *pxTask );
+static void prvJobExit( cTCB_t *pxTask );
+static void prvTimeBaseTick();
+#if( configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 || configENABLE_CHAINS == 1 || \
+     configENABLE_SPORADIC == 1 || configENABLE_PARTITIONS == 1 || configENABLE_DUAL_PRIORITY == 1 || configENABLE_LET == 1 || \
+     configENABLE_ELASTIC == 1 || configENABLE_OVERLOAD == 1 || configENABLE_FIRM_APERIODIC == 1 )
+    static cTCB_t *prvGetTCBFromListByTaskHandle( TaskHandle_t *pxTaskHandle );
+#endif
 #if( configENABLE_RM == 1 )
     static void prvInitialiseTCBItemRMS( cTCB_t *pxTCB );
-    static cTCB_t *prvGetTCBFromListByHandleRMS(TaskHandle_t xTaskHandle);
+    #if( configENABLE_PREEMPTION_THRESHOLD == 0 )
+        static cTCB_t *prvGetTCBFromListByHandleRMS(TaskHandle_t xTaskHandle);
+    #endif
     #if(configENABLE_FIXED == 0)
         static void prvAssignPriorityRMS();
     #endif
@@ -93,17 +429,223 @@ static void prvPeriodicTaskMaster( void *pvParameters );
     static void prvSchedulerEDFCode();
     static void prvSchedulerEDFCreate();
     static void prvInitialiseTCBItemEDF( cTCB_t *pxTCB );
+    static uint64_t prvExtendTime( TickType_t xTime );
+    static TickType_t prvGetDeadlineKey( cTCB_t *pxTCB, uint64_t ullNow );
     static void prvNotifySchedulerEDF();
     static cTCB_t *prvGetTCBFromListByHandleEDF(TaskHandle_t xTaskHandle);
 #endif
 #if( configENABLE_APERIODIC == 1 )
     static void prvInitialiseTCBAItem( cTCBA_t *pxTCBA );
-    static void prvPollingServerCode();
-    static void prvPollingServerInit();
+    #if( configENABLE_SLACK_STEALING == 0 )
+        static cTCBA_t *prvPollingServerDispatch( cTCB_t *pxTCB );
+        static void prvPollingServerCode();
+        static void prvPollingServerInit();
+    #endif
+#endif
+#if( configENABLE_FIRM_APERIODIC == 1 )
+    static void prvFirmSiftUp( cTCBA_t **ppxHeap, UBaseType_t uxSlot );
+    static void prvFirmSiftDown( cTCBA_t **ppxHeap, UBaseType_t uxCount, UBaseType_t uxSlot );
+    static cTCBA_t *prvFirmPop( cTCBA_t **ppxHeap, UBaseType_t *puxCount );
+    static BaseType_t prvFirmAcceptanceTest( cTCBA_t *pxNew );
+    static void prvFirmServe( cTCB_t *pxServer );
+#endif
+#if( configENABLE_SLACK_STEALING == 1 )
+    static TickType_t prvGetLevelDemand( ListItem_t *pxLevel, TickType_t xNow, TickType_t xEnd );
+    static TickType_t prvGetLevelSlack( ListItem_t *pxLevel, TickType_t xNow );
+    static TickType_t prvGetAvailableSlack();
+    static void prvSlackStealerCode();
+    static void prvSlackStealerCreate();
 #endif
 #if( (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
+    static BaseType_t prvCheckFeasibility();
     static BaseType_t prvCheckFeasibilitySTD( void );
-    static BaseType_t prvCheckFeasibilityWCRT( void );
+    static BaseType_t prvCheckFeasibilityWCRT( List_t *pxList, BaseType_t xVerbose );
+    #if( configENABLE_RM == 1 || configENABLE_GENERATOR == 1 || configENABLE_POLICY_SELECT == 1 )
+        static BaseType_t prvCheckHyperbolicBound( List_t *pxList );
+    #endif
+    #if( configENABLE_EDF == 1 || configENABLE_GENERATOR == 1 )
+        static BaseType_t prvCheckUtilisationBound( List_t *pxList );
+    #endif
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        static BaseType_t prvCheckFeasibilityThreshold( List_t *pxList, BaseType_t xVerbose );
+        static TickType_t prvGetResponseTimeThreshold( List_t *pxList, cTCB_t *pxTCB );
+        static void prvAssignThresholds();
+    #endif
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        static BaseType_t prvCheckFeasibilityDualPriority( BaseType_t xVerbose );
+    #endif
+    #if( configENABLE_ARBITRARY_DEADLINE == 1 )
+        static BaseType_t prvCheckFeasibilityBusyPeriod( List_t *pxList, BaseType_t xVerbose );
+        static TickType_t prvGetResponseTimeBusyPeriod( List_t *pxList, ListItem_t *pxItem, UBaseType_t *puxJobs );
+    #endif
+    #if( configENABLE_GENERATOR == 1 || ( configENABLE_MULTICORE == 1 && configENABLE_EDF == 1 ) )
+        static BaseType_t prvCheckProcessorDemandEDF( List_t *pxList );
+        static TickType_t prvGetProcessorDemand( List_t *pxList, TickType_t xT );
+        static TickType_t prvGetDeadlineBefore( List_t *pxList, TickType_t xT );
+    #endif
+#endif
+#if( configENABLE_SRP == 1 )
+    static void prvSetResourceCeilings();
+    #if( configENABLE_EDF == 1 )
+        static void prvApplySystemCeilingEDF();
+        #if( configENABLE_FIXED == 0 )
+            static BaseType_t prvCheckBlockingBoundEDF( List_t *pxList );
+        #endif
+    #endif
+#endif
+#if( configENABLE_MIXED_CRITICALITY == 1 )
+    static BaseType_t prvCheckFeasibilityAMC( List_t *pxList, BaseType_t xVerbose );
+    static TickType_t prvGetResponseTimeAMC( List_t *pxList, ListItem_t *pxItem, TickType_t xRLO );
+    static void prvModeSwitchCode();
+#endif
+#if( configENABLE_MK_FIRM == 1 )
+    static TickType_t prvGetMandatoryJobs( cTCB_t *pxTCB, TickType_t xJobs );
+    static BaseType_t prvIsMandatoryJob( cTCB_t *pxTCB );
+    static UBaseType_t prvGetDistanceToFailure( cTCB_t *pxTCB );
+    static void prvRecordJobOutcome( cTCB_t *pxTCB, BaseType_t xMet );
+    static void prvPrintFirmPatterns();
+    static void prvSetOptionalBand();
+    static UBaseType_t prvGetOptionalPriority( cTCB_t *pxTCB );
+    static void prvOptionalJobsTick( TickType_t xTick );
+    static void prvAbortCode();
+#endif
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+    static void prvCreateThresholdGroups();
+    static cTCB_t *prvGetPendingJobFromGroup( cGroup_t *pxGroup );
+    static cTCB_t *prvGetTCBFromGroupByHandle( TaskHandle_t xTaskHandle );
+    static void prvThresholdGroupCode( void *pvParameters );
+    static void prvThresholdReleaseCode();
+#endif
+#if( configENABLE_BENCHMARK == 1 || configENABLE_PROFILING == 1 || configENABLE_OVERHEADS == 1 )
+    static uint32_t prvGetCycleCount();
+#endif
+#if( configENABLE_OVERHEADS == 1 )
+    static TickType_t prvGetTickInterference( TickType_t xWindow );
+    static void prvCalibrateOverheads();
+    static void prvCalibrationSwitchCode();
+    static void prvCalibrationCode();
+    static void prvCalibrationCreate();
+#endif
+#if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+    static void prvSporadicWaitRelease( cTCB_t *pxTask, BaseType_t xFirst );
+#endif
+#if( configENABLE_SPORADIC == 1 )
+    static cTCB_t *prvGetSporadicTCB( TaskHandle_t *pxTaskHandle );
+#endif
+#if( configENABLE_CHAINS == 1 )
+    static TickType_t prvChainGetMaxInterArrival( cTCB_t *pxTCB );
+    static BaseType_t prvCheckChains();
+    #if( configCHAIN_TUNING == 1 )
+        static void prvChainAssignDepths();
+        static void prvChainTune();
+    #endif
+#endif
+#if( configENABLE_PARTITIONS == 1 )
+    static void prvPartitionAssignBands();
+    static TickType_t prvPartitionSupplyBound( cPartition_t *pxPartition, TickType_t xBudget, TickType_t xT );
+    #if( configENABLE_RM == 1 )
+        static TickType_t prvPartitionRequestBound( ListItem_t *pxItem, TickType_t xT );
+    #elif( configENABLE_EDF == 1 )
+        static TickType_t prvPartitionDemandBound( UBaseType_t uxPartition, TickType_t xT );
+    #endif
+    static BaseType_t prvCheckPartitionLocal( UBaseType_t uxPartition, TickType_t xBudget );
+    static BaseType_t prvCheckFeasibilityPartitions( BaseType_t xVerbose );
+    static void prvPartitionSetActive( UBaseType_t uxPartition, BaseType_t xActive );
+    static void prvPartitionTick( TaskHandle_t xCurrentTaskHandle, cTCB_t *pxTask );
+    static void prvPartitionIdleCode( void *pvParameters );
+    static void prvPartitionsCode();
+    static void prvPartitionsCreate();
+#endif
+#if( configENABLE_DUAL_PRIORITY == 1 )
+    static void prvPromotionCode();
+    static void prvDualPriorityCreate();
+#endif
+#if( configENABLE_LIMITED_PREEMPTION == 1 )
+    static TickType_t prvGetWorkload( ListItem_t *pxItem, TickType_t xT );
+    static void prvAssignNPRLengths();
+    static void prvNPREnter( cTCB_t *pxTask );
+    static void prvNPRExit( cTCB_t *pxTask );
+    static void prvCountPreemption( cTCB_t *pxTask, TickType_t xStartTick );
+    static void prvNPRCode();
+#endif
+#if( configENABLE_COROUTINES == 1 )
+    static void prvCoRoutineRegister( cTCB_t *pxTCB );
+    static void prvAssignPriorityCoRoutines();
+    static void prvCoRoutineMaster( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+    static void prvCoRoutinesCreate();
+    #if( configENABLE_FIXED == 0 )
+        static BaseType_t prvCheckFeasibilityCoRoutines( BaseType_t xVerbose );
+    #endif
+#endif
+#if( configENABLE_RECLAIMING == 1 )
+    static void prvCapacityExpire( TickType_t xNow );
+    static void prvCapacityRelease( cTCB_t *pxTask );
+    static BaseType_t prvCapacityEligible( cCapacity_t *pxCapacity, cTCB_t *pxServer, TickType_t xNow );
+    static TickType_t prvCapacityAvailable( cTCB_t *pxServer );
+    static BaseType_t prvCapacityConsume( cTCB_t *pxServer );
+    static void prvServerCharge( cTCB_t *pxServer );
+    static void prvBudgetCode();
+#endif
+#if( configENABLE_LET == 1 )
+    static BaseType_t prvCheckLETPorts();
+    static void prvLETStart();
+    static void prvLETTick( TickType_t xNow );
+#endif
+#if( configENABLE_ELASTIC == 1 )
+    static BaseType_t prvElasticCompress( float xUd );
+    static BaseType_t prvElasticCompute();
+    static void prvElasticStart();
+    static BaseType_t prvElasticStretching();
+    static void prvElasticApply( cTCB_t *pxTCB );
+#endif
+#if( configENABLE_OVERLOAD == 1 )
+    static BaseType_t prvOverloadPending( cTCB_t *pxTCB, uint64_t ullNow );
+    static BaseType_t prvOverloadLess( cTCB_t *pxTCB, cTCB_t *pxVictim );
+    static BaseType_t prvOverloadCheck( cTCB_t *pxTask );
+    static void prvOverloadReject( cTCB_t *pxTask );
+#endif
+#if( configENABLE_BACKGROUND == 1 )
+    static void prvBackgroundRunChunk();
+#endif
+#if( configENABLE_BENCHMARK == 1 )
+    static void prvBenchmarkDummyCode( void *pvParameters );
+    static void prvBenchmarkCreateTaskSet( UBaseType_t uxTasks );
+    static void prvBenchmarkDeleteTaskSet();
+    static void prvBenchmarkReport( const char *pcMetric, UBaseType_t uxTasks, const uint32_t *pulSamples );
+    static void prvBenchmarkSweep();
+    static void prvBenchmarkCode( void *pvParameters );
+#endif
+#if( configENABLE_GENERATOR == 1 )
+    static float prvGenUniform();
+    static BaseType_t prvGenUUniFast( float xU, float *pxU );
+    static TickType_t prvGenPeriod( BaseType_t xHarmonic );
+    static BaseType_t prvGenTaskSet( float xU, BaseType_t xHarmonic );
+#endif
+#if( configENABLE_PROFILING == 1 )
+    static void prvProfilingFitGumbel( const uint32_t *pulSamples, float *pxMu, float *pxBeta );
+    static uint32_t prvProfilingGetPWCET( float xMu, float xBeta, UBaseType_t uxExceedance, uint32_t ulHWM );
+    static void prvProfilingCode( void *pvParameters );
+#endif
+#if( configENABLE_MULTICORE == 1 )
+    static float prvMulticoreGetKey( cTCB_t *pxTCB, BaseType_t xDensity );
+    static float prvMulticoreGetLoad( List_t *pxCore, BaseType_t xDensity );
+    static BaseType_t prvMulticoreFits( cTCB_t *pxTCB, List_t *pxCore );
+    static UBaseType_t prvMulticoreAssign( UBaseType_t uxTasks, UBaseType_t uxFit, BaseType_t xDensity, UBaseType_t uxCores,
+                                           BaseType_t xOnDemand );
+    static BaseType_t prvMulticoreSimulate( List_t *pxCore, TickType_t *pxHorizon, BaseType_t *pxTruncated );
+#endif
+#if( configENABLE_POLICY_SELECT == 1 )
+    static TickType_t prvGetKeyFixed( cTCB_t *pxTCB );
+    static TickType_t prvGetKeyRM( cTCB_t *pxTCB );
+    static TickType_t prvGetKeyEDF( cTCB_t *pxTCB );
+    static void prvSetRM();
+
+    /* Dispatch table of the policies, indexed by POLICY_FIXED, POLICY_RM and POLICY_EDF */
+    static const cPolicy_t xPolicies[] = {
+        { "FIXED", prvGetKeyFixed, NULL,      NULL,                     NULL,        pdFALSE },
+        { "RM",    prvGetKeyRM,    prvSetRM,  prvCheckHyperbolicBound,  "U_max > 2", pdFALSE },
+        { "EDF",   prvGetKeyEDF,   prvSetEDF, prvCheckUtilisationBound, "U_max > 1", pdTRUE }
+    };
 #endif
 /**
  * ---------------------------------------------------------------------------------
@@ -129,8 +671,29 @@ void vInitScheduler(){
         pxTASK_List = &xTASK_List;                  // Assigning pointer to List
         pxTASK_List_tmp = &xTASK_List_tmp;          // Assigning pointer to temp List
     #endif
+    #if( configENABLE_PARTITIONS == 1 )
+        vListInitialise( &xPartition_List );        // Creation of Reservations List
+    #endif
+    #if( configENABLE_COROUTINES == 1 )
+        vListInitialise( &xCoRoutine_List );        // Creation of Co-routines List
+    #endif
+    #if( configENABLE_BACKGROUND == 1 )
+        vListInitialise( &xBackground_List );       // Creation of Background works queue
+    #endif
+    #if( configENABLE_POLICY_SELECT == 1 )
+        pxPolicy = &xPolicies[ POLICY_EDF ];        // Default policy of the EDF build
+    #endif
 }
 
+#if( configENABLE_POLICY_SELECT == 1 )
+    /* Initialize Real Time environment with the scheduling policy chosen at runtime (POLICY_FIXED, POLICY_RM or POLICY_EDF) */
+    void vInitSchedulerPolicy( UBaseType_t uxPolicy ){
+        vInitScheduler();
+        if( uxPolicy <= POLICY_EDF )
+            pxPolicy = &xPolicies[ uxPolicy ];
+    }
+#endif
+
 /* Function to create a custom TCB for periodic tasks and fill it with Task parameters set by user */
 void vPeriodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHandle_t *pxTaskHandle,
                           const uint32_t ulStackDepth, void *pvParameters, BaseType_t xPriority,
@@ -153,14 +716,106 @@ void vPeriodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHan
     pxTCB->xTaskJobStatus = pdTRUE;
     pxTCB->xTimeSpent = 0;
     pxTCB->xWCRT = xWCET;
+    pxTCB->xLastWakeTime = xStartTime;
+    #if( configENABLE_LET == 1 )
+        pxTCB->xLETDone = pdFALSE;
+    #endif
+    #if( configENABLE_ELASTIC == 1 )
+        // Rigid by default: the nominal period is the only one
+        pxTCB->xPeriodMin = xPeriod;
+        pxTCB->xPeriodMax = xPeriod;
+        pxTCB->uxElasticity = 0;
+        pxTCB->xPeriodNext = xPeriod;
+        pxTCB->xWCETNext = xWCET;
+        pxTCB->xImplicitDeadline = ( xDeadline == xPeriod ) ? pdTRUE : pdFALSE;
+        pxTCB->xElasticFixed = pdTRUE;
+    #endif
+    #if( configENABLE_OVERLOAD == 1 )
+        pxTCB->uxValue = 1;
+        pxTCB->xTolerance = 0;
+        pxTCB->xRejected = pdFALSE;
+    #endif
 
     #if(configENABLE_APERIODIC == 1 )
-        pxTCB->xPS = pdTRUE;
+        #if( configENABLE_SLACK_STEALING == 0 )
+            // Only the Polling Server spends the budget (the other tasks give back theirs to it with the reclaiming)
+            pxTCB->xPS = ( pxTaskHandle == &xPSHandle ) ? pdTRUE : pdFALSE;
+        #else
+            pxTCB->xPS = pdFALSE;
+        #endif
         pxTCB->xBudgetPS = configMAX_BUDGET_PS;
     #endif
 
+    #if( configENABLE_SLACK_STEALING == 1 )
+        pxTCB->xJobRelease = pxTCB->xArrivalTime + xStartTime;
+    #endif
+
+    #if( configENABLE_SRP == 1 || configENABLE_LIMITED_PREEMPTION == 1 )
+        pxTCB->xBlocking = 0;
+    #endif
+
+    #if( configENABLE_SRP == 1 )
+        pxTCB->xPreemptionLevel = xPriority;
+        memset( pxTCB->xCSLength, 0, sizeof( pxTCB->xCSLength ) );
+    #endif
+
+    #if( configENABLE_MIXED_CRITICALITY == 1 )
+        pxTCB->xCriticality = CRITICALITY_LO;
+        pxTCB->xWCETHigh = xWCET;
+    #endif
+
+    #if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+        pxTCB->xArrivalQueue = NULL;
+    #endif
+
+    #if( configENABLE_SPORADIC == 1 )
+        pxTCB->xLastArrival = 0;
+        pxTCB->uxArrivals = 0;
+        pxTCB->uxRejected = 0;
+    #endif
+
+    #if( configENABLE_CHAINS == 1 )
+        pxTCB->pxTrigger = NULL;
+        pxTCB->uxChainDepth = 0;
+    #endif
+
+    #if( configENABLE_PARTITIONS == 1 )
+        pxTCB->uxPartition = 0;
+    #endif
+
+    #if( configENABLE_LIMITED_PREEMPTION == 1 )
+        pxTCB->xNPRLength = 0;
+        pxTCB->xNPRTime = 0;
+        pxTCB->xInNPR = pdFALSE;
+        pxTCB->uxPreemptions = 0;
+    #endif
+
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        pxTCB->xSoft = pdFALSE;
+        pxTCB->xLowPriority = xPriority;
+        pxTCB->xPromotion = 0;
+        pxTCB->xNextPromotion = 0;
+    #endif
+
+    #if( configENABLE_MK_FIRM == 1 )
+        // Hard task by default: every job is mandatory
+        pxTCB->uxM = 1;
+        pxTCB->uxK = 1;
+        pxTCB->uxJobIndex = 0;
+        pxTCB->ulHistory = 1;
+        pxTCB->xOptional = pdFALSE;
+        pxTCB->xAborted = pdFALSE;
+    #endif
+
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        pxTCB->xThreshold = xPriority;
+        pxTCB->uxGroup = 0;
+        pxTCB->uxPendingJobs = 0;
+        pxTCB->xNextRelease = pxTCB->xArrivalTime + xStartTime;
+    #endif
+
     #if( configENABLE_EDF == 1 )
-        pxTCB->xAbsDeadline = pxTCB->xDeadline + pxTCB->xArrivalTime + xStartTime;
+        pxTCB->ullAbsDeadline = pxTCB->xDeadline + pxTCB->xArrivalTime + prvExtendTime( xStartTime );
         prvInitialiseTCBItemEDF( pxTCB );
     #endif
 
@@ -168,6 +823,11 @@ void vPeriodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHan
         prvInitialiseTCBItemRMS( pxTCB );
     #endif
 
+    #if( configENABLE_COROUTINES == 1 )
+        // A job without stack runs to completion as a co-routine on the stack of the Idle Task: it MUST NOT block
+        if( ulStackDepth == 0 )
+            prvCoRoutineRegister( pxTCB );
+    #endif
 }
 
 #if(configENABLE_APERIODIC == 1)
@@ -182,481 +842,5241 @@ void vPeriodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHan
         pxTCBA->xArrival = xArrival;
         prvInitialiseTCBAItem( pxTCBA );
 
+        #if( configENABLE_SLACK_STEALING == 1 )
+            // Wake up the Slack Stealer (only once it has been created)
+            if( xSlackStealerHandle != NULL )
+                xTaskNotifyGive( xSlackStealerHandle );
+        #endif
     }
 #endif
 
-/* Personalized vTaskStartScheduler function for Real Time environment */
-void vTaskStartRealTimeScheduler(){
-    #if(configENABLE_APERIODIC == 1)
-        prvPollingServerInit();
-    #endif
-    #if( configENABLE_RM == 1 )
-        #if( configENABLE_FIXED == 0)
-            prvAssignPriorityRMS();
-        #endif
-    #elif( configENABLE_EDF == 1 )
-        prvSetEDF();
-        prvSchedulerEDFCreate();
-    #endif
+#if( configENABLE_FIRM_APERIODIC == 1 )
+    /* Submit an aperiodic job with a firm deadline xDeadline ticks after now: it is queued by deadline only if the
+     * acceptance test guarantees it on the Polling Server, otherwise pdFALSE is returned at once */
+    BaseType_t xAperiodicTaskCreateFirm( TaskFunction_t pxTaskCode, const char *pcName, void *pvParameters, TickType_t xWCET,
+                                         TickType_t xDeadline ){
+        BaseType_t xAccepted;
+        UBaseType_t uxAccepted, uxRejected;
+        // An accepted job can be served and freed as soon as the scheduler is resumed
+        uint64_t ullAbsDeadline = ullGetTickCount64() + xDeadline;
+        cTCBA_t *pxTCBA = pvPortMalloc(sizeof( cTCBA_t ));
+        if( pxTCBA == NULL )
+            return pdFALSE;
 
-    #if( (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
-        if( prvCheckFeasibilitySTD() == pdFALSE )
-            printf("\nSTANDARD FEASIBILITY TEST NOT PASSED\n");
-        if( prvCheckFeasibilityWCRT() == pdFALSE ){
-            printf( "\nFEASIBILITY WCRT TEST FAILED - The Task Set is not schedulable - EXITING PROGRAM\n\n");
-            return;
-        }else printf("\nFEASIBILITY WCRT TEST PASSED\n");
-    #endif
-    prvCallTaskCreate();
-    xStartTime = xTaskGetTickCount();
-    vTaskStartScheduler();
-}
-/**
- * ---------------------------------------------------------------------------------
- */
+        pxTCBA->pxTaskCode = pxTaskCode;
+        pxTCBA->pcName = pcName;
+        pxTCBA->pvParameters = pvParameters;
+        pxTCBA->xWCET = xWCET;
+        pxTCBA->xArrival = 0;
+        pxTCBA->ullAbsDeadline = ullAbsDeadline;
 
-/**
- * ---------------------------------------------------------------------------------
- * Private Functions
- */
+        // The Polling Server can not take the queue while the job is tested and pushed
+        vTaskSuspendAll();
+        xAccepted = prvFirmAcceptanceTest( pxTCBA );
+        if( xAccepted == pdTRUE ){
+            taskENTER_CRITICAL();
+            pxFirmJobs[ uxFirmJobs ] = pxTCBA;
+            prvFirmSiftUp( pxFirmJobs, uxFirmJobs );
+            uxFirmJobs++;
+            taskEXIT_CRITICAL();
+            uxFirmAccepted++;
+        }else uxFirmRejected++;
+        uxAccepted = uxFirmAccepted;
+        uxRejected = uxFirmRejected;
+        xTaskResumeAll();
 
-/*Hook function called in the System Tick Handler after any OS work is completed*/
+        printf( "\n[PS] Tick count %lu - Firm Aperiodic Task %s %s - Deadline %lu - Accepted %lu - Rejected %lu\n",
+                xTaskGetTickCount(), pcName, ( xAccepted == pdTRUE ) ? "accepted" : "rejected",
+                ( TickType_t ) ullAbsDeadline, uxAccepted, uxRejected );
+        if( xAccepted == pdFALSE )
+            vPortFree( pxTCBA );
+        return xAccepted;
+    }
+#endif
 
-void vApplicationTickHook( void ){
-    #if( mainASSIGN_IP_DEMO == 1 )
-        return;
-    #endif
-    TaskHandle_t xCurrentTaskHandle = xTaskGetCurrentTaskHandle();
-    #if( configENABLE_RM == 1 )
-        cTCB_t *pxTask = prvGetTCBFromListByHandleRMS(xCurrentTaskHandle);
-        if( pxTask != NULL && xCurrentTaskHandle != xTaskGetIdleTaskHandle())
-        {
-            pxTask->xTimeSpent++;
-            #if(configENABLE_APERIODIC == 1)
-                if(pxTask->xPS == pdTRUE)
-                    pxTask->xBudgetPS--;
-            #endif
+#if( configENABLE_SPORADIC == 1 )
+    /* Create a sporadic task: a periodic task whose jobs are released by events (xSporadicTaskRelease), at least
+     * xMinInterArrival apart. It is analysed as a periodic task of period xMinInterArrival */
+    void vSporadicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHandle_t *pxTaskHandle,
+                              const uint32_t ulStackDepth, void *pvParameters, BaseType_t xPriority,
+                              TickType_t xMinInterArrival, TickType_t xDeadline, TickType_t xWCET ){
+        cTCB_t *pxTCB;
+        if( uxSporadicTasks == configMAX_SPORADIC ) return;
+
+        vPeriodicTaskCreate( pxTaskCode, pcName, pxTaskHandle, ulStackDepth, pvParameters, xPriority, 0,
+                             xMinInterArrival, xDeadline, xWCET );
+        pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL ) return;
+
+        pxTCB->xArrivalQueue = xQueueCreate( configSPORADIC_QUEUE_LENGTH, sizeof( TickType_t ) );
+        if( pxTCB->xArrivalQueue == NULL ){
+            // Without its queue the task would run as a periodic one: it is not created at all
+            uxListRemove( &pxTCB->pxTCBItem );
+            vPortFree( pxTCB );
+            printf( "\nSPORADIC TASK %s NOT CREATED - No memory left for its arrival queue\n", pcName );
+            return;
         }
-    #elif( configENABLE_EDF == 1 )
-        cTCB_t *pxTask = prvGetTCBFromListByHandleEDF(xCurrentTaskHandle);
-        if( pxTask != NULL && xCurrentTaskHandle != xSchedulerEDFHandle && xCurrentTaskHandle != xTaskGetIdleTaskHandle())
-            pxTask->xTimeSpent++;
-    #endif
-}
+        pxSporadicTCBs[ uxSporadicTasks ] = pxTCB;
+        uxSporadicTasks++;
+    }
 
-/* Hook function called when the Idle Task is activated*/
-void vApplicationIdleHook( void ){
-    xIdleFlag = 1;
-}
+    /* Signal an arrival of a sporadic task from a task: pdFALSE if the arrival is rejected */
+    BaseType_t xSporadicTaskRelease( TaskHandle_t *pxTaskHandle ){
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        BaseType_t xAccepted;
 
-#if( (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
-    /* Feasibility Test Standard*/
-    static BaseType_t prvCheckFeasibilitySTD( void ){
-        #if( configENABLE_RM == 1 )
-            float xU = 1.0;
-            float adder = 1.0;
-        #elif( configENABLE_EDF == 1 )
-            float xU = 0.0;
+        // The ISR version keeps the bookkeeping consistent with the arrivals signalled by the interrupts
+        taskENTER_CRITICAL();
+        xAccepted = xSporadicTaskReleaseFromISR( pxTaskHandle, &xHigherPriorityTaskWoken );
+        taskEXIT_CRITICAL();
+        if( xHigherPriorityTaskWoken == pdTRUE )
+            taskYIELD();
+        return xAccepted;
+    }
+
+    /* Signal an arrival of a sporadic task from an ISR: pdFALSE if the arrival is rejected */
+    BaseType_t xSporadicTaskReleaseFromISR( TaskHandle_t *pxTaskHandle, BaseType_t *pxHigherPriorityTaskWoken ){
+        cTCB_t *pxTCB = prvGetSporadicTCB( pxTaskHandle );
+        TickType_t xNow = xTaskGetTickCountFromISR();
+        BaseType_t xAccepted = pdTRUE;
+        UBaseType_t uxSavedInterruptStatus;
+        if( pxTCB == NULL ) return pdFALSE;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        #if( configSPORADIC_REJECT == 1 )
+            // The arrivals closer than the minimum inter-arrival time to the last accepted one are rejected
+            if( pxTCB->uxArrivals > 0 && ( TickType_t ) ( xNow - pxTCB->xLastArrival ) < pxTCB->xPeriod )
+                xAccepted = pdFALSE;
         #endif
+        // Otherwise the arrival is queued and its job deferred if needed, unless too many are pending
+        if( xAccepted == pdTRUE && xQueueSendFromISR( pxTCB->xArrivalQueue, &xNow, pxHigherPriorityTaskWoken ) != pdPASS )
+            xAccepted = pdFALSE;
 
-        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        if( xAccepted == pdTRUE ){
+            pxTCB->xLastArrival = xNow;
+            pxTCB->uxArrivals++;
+        }else pxTCB->uxRejected++;
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        return xAccepted;
+    }
+#endif
 
-        cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+#if( configENABLE_SRP == 1 )
+    /* Declare the longest critical section of a periodic task (already created) on a resource */
+    void vResourceUse( TaskHandle_t *pxTaskHandle, UBaseType_t uxResource, TickType_t xCSLength ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL || uxResource >= configMAX_RESOURCES ) return;
 
-        while( pxTCB_Pointer != pxTCB_Tail ){
-            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-            #if( configENABLE_RM == 1 )
-                    xU *= (float) pxTCB->xWCET / pxTCB->xPeriod + adder ;
-            #elif( configENABLE_EDF == 1 )
-                    xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
-            #endif
+        if( xCSLength > pxTCB->xCSLength[ uxResource ] )
+            pxTCB->xCSLength[ uxResource ] = xCSLength;
+    }
+
+    /* Enter a critical section: no task that uses the resource can start until it is given back */
+    void vResourceTake( UBaseType_t uxResource ){
+        cRCB_t *pxResource = &xResources[ uxResource ];
+
+        #if( configENABLE_EDF == 1 )
+            // Raise the system ceiling and let the scheduler hold back the jobs not started below it
+            pxResource->xSaved = xSystemCeiling;
+            if( pxResource->xCeiling > xSystemCeiling )
+                xSystemCeiling = pxResource->xCeiling;
+            prvNotifySchedulerEDF();
+        #else
+            // Immediate ceiling: the holder runs at the highest priority among the users of the resource
+            pxResource->xSaved = uxTaskPriorityGet( NULL );
+            if( pxResource->xCeiling > pxResource->xSaved )
+                vTaskPrioritySet( NULL, pxResource->xCeiling );
+        #endif
+    }
+
+    /* Exit a critical section (resources are given back in the reverse order they were taken) */
+    void vResourceGive( UBaseType_t uxResource ){
+        cRCB_t *pxResource = &xResources[ uxResource ];
+
+        #if( configENABLE_EDF == 1 )
+            xSystemCeiling = pxResource->xSaved;
+            prvNotifySchedulerEDF();
+        #else
+            vTaskPrioritySet( NULL, pxResource->xSaved );
+        #endif
+    }
+#endif
+
+#if( configENABLE_LIMITED_PREEMPTION == 1 )
+    /* Preemption point: the jobs released since the last one can preempt the job here (with fixed preemption points
+     * the next non-preemptive region starts as soon as they complete) */
+    void vPreemptionPoint(){
+        cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS( xTaskGetCurrentTaskHandle() );
+        if( pxTCB == NULL ) return;
+
+        prvNPRExit( pxTCB );
+        #if( configLP_FIXED_POINTS == 1 )
+            prvNPREnter( pxTCB );
+        #endif
+    }
+
+    /* Enter a non-preemptive region: it lasts at most the NPR length of the task */
+    void vNPRBegin(){
+        cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS( xTaskGetCurrentTaskHandle() );
+        if( pxTCB == NULL || pxTCB->xInNPR == pdTRUE ) return;
+
+        prvNPREnter( pxTCB );
+    }
+
+    /* Exit a non-preemptive region */
+    void vNPREnd(){
+        cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS( xTaskGetCurrentTaskHandle() );
+        if( pxTCB == NULL ) return;
+
+        prvNPRExit( pxTCB );
+    }
+#endif
+
+#if( configENABLE_MIXED_CRITICALITY == 1 )
+    /* Set the criticality of a periodic task (already created) and its WCET in HI mode */
+    void vPeriodicTaskSetCriticality( TaskHandle_t *pxTaskHandle, BaseType_t xCriticality, TickType_t xWCETHigh ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL ) return;
+
+        pxTCB->xCriticality = xCriticality;
+        // The HI budget can not be smaller than the LO one
+        pxTCB->xWCETHigh = ( xWCETHigh > pxTCB->xWCET ) ? xWCETHigh : pxTCB->xWCET;
+    }
+#endif
+
+#if( configENABLE_MK_FIRM == 1 )
+    /* Make a periodic task (already created) (m,k)-firm: at least m jobs out of any k consecutive ones meet the deadline */
+    void vPeriodicTaskSetFirm( TaskHandle_t *pxTaskHandle, UBaseType_t uxM, UBaseType_t uxK ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL || uxM == 0 || uxM > uxK || uxK > configMAX_FIRM_WINDOW )
+            return;
+
+        pxTCB->uxM = uxM;
+        pxTCB->uxK = uxK;
+        // The jobs before the first one are considered met
+        pxTCB->ulHistory = ( uxK == 32 ) ? 0xFFFFFFFFUL : ( ( 1UL << uxK ) - 1 );
+    }
+
+    /* Polled by the code of an optional job: pdTRUE once its deadline is reached, the job should return at once.
+     * A job still running configMK_ABORT_GRACE ticks later is restarted by the Abort Task */
+    BaseType_t xPeriodicJobAborted(){
+        cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS( xTaskGetCurrentTaskHandle() );
+        if( pxTCB == NULL )
+            return pdFALSE;
+
+        return pxTCB->xAborted;
+    }
+#endif
+
+#if( configENABLE_DUAL_PRIORITY == 1 )
+    /* Make a periodic task (already created) soft: no guarantee, but its jobs run ahead of the hard jobs not promoted yet */
+    void vPeriodicTaskSetSoft( TaskHandle_t *pxTaskHandle ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL ) return;
+
+        pxTCB->xSoft = pdTRUE;
+    }
+#endif
+
+#if( configENABLE_CHAINS == 1 )
+    /* Make a periodic task (already created) event-triggered: its jobs are released by the completed jobs of the trigger,
+     * at least one period apart */
+    void vPeriodicTaskSetTrigger( TaskHandle_t *pxTaskHandle, TaskHandle_t *pxTriggerHandle ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        cTCB_t *pxTrigger = prvGetTCBFromListByTaskHandle( pxTriggerHandle );
+        cTCB_t *pxRoot;
+        // A period longer than the one of the trigger would queue the releases without bound
+        if( pxTCB == NULL || pxTrigger == NULL || pxTCB->xPeriod > pxTrigger->xPeriod || pxTCB->xArrivalQueue != NULL )
+            return;
+
+        // The triggers must lead to a time-triggered task
+        for( pxRoot = pxTrigger; pxRoot != NULL; pxRoot = pxRoot->pxTrigger )
+            if( pxRoot == pxTCB )
+                return;
+        // The completed jobs of the trigger are the arrivals of a sporadic task
+        pxTCB->xArrivalQueue = xQueueCreate( configSPORADIC_QUEUE_LENGTH, sizeof( TickType_t ) );
+        if( pxTCB->xArrivalQueue != NULL )
+            pxTCB->pxTrigger = pxTrigger;
+    }
+
+    /* Create an empty chain with its end-to-end deadline on the latency (0 if none) */
+    void vChainCreate( UBaseType_t uxChain, const char *pcName, TickType_t xDeadline ){
+        if( uxChain >= configMAX_CHAINS ) return;
+
+        xChains[ uxChain ].pcName = pcName;
+        xChains[ uxChain ].xDeadline = xDeadline;
+        xChains[ uxChain ].uxLength = 0;
+    }
+
+    /* Append a periodic task (already created) to a chain: it reads the data written by the previous stage */
+    void vChainAddTask( UBaseType_t uxChain, TaskHandle_t *pxTaskHandle ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL || uxChain >= configMAX_CHAINS || xChains[ uxChain ].pcName == NULL ||
+            xChains[ uxChain ].uxLength == configMAX_CHAIN_LENGTH )
+            return;
+        // A sporadic task (not triggered) can only read the input of the chain: nobody bounds the time between its jobs
+        if( xChains[ uxChain ].uxLength > 0 && pxTCB->xArrivalQueue != NULL && pxTCB->pxTrigger == NULL )
+            return;
+
+        xChains[ uxChain ].pxStages[ xChains[ uxChain ].uxLength ] = pxTCB;
+        xChains[ uxChain ].uxLength++;
+    }
+#endif
+
+#if( configENABLE_LET == 1 )
+    /* Create a port written by a periodic task (already created) under the Logical Execution Time: double buffered by
+     * the two buffers given, of the same type, holding the initial value in pvBufferA */
+    void vLETPortCreate( UBaseType_t uxPort, const char *pcName, TaskHandle_t *pxWriterHandle, void *pvBufferA,
+                         void *pvBufferB ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxWriterHandle );
+        if( pxTCB == NULL || uxPort >= configMAX_LET_PORTS || xLETPorts[ uxPort ].pxWriter != NULL || pvBufferA == NULL ||
+            pvBufferB == NULL )
+            return;
+
+        xLETPorts[ uxPort ].pcName = pcName;
+        xLETPorts[ uxPort ].pxWriter = pxTCB;
+        xLETPorts[ uxPort ].pvBuffers[ 0 ] = pvBufferA;
+        xLETPorts[ uxPort ].pvBuffers[ 1 ] = pvBufferB;
+        xLETPorts[ uxPort ].uxBuffers = 2;
+        xLETPorts[ uxPort ].uxReaders = 0;
+    }
+
+    /* Add a buffer to a port, for the readers holding their input across more than one job of the writer */
+    void vLETPortAddBuffer( UBaseType_t uxPort, void *pvBuffer ){
+        if( uxPort >= configMAX_LET_PORTS || xLETPorts[ uxPort ].pxWriter == NULL || pvBuffer == NULL ||
+            xLETPorts[ uxPort ].uxBuffers == configMAX_LET_BUFFERS )
+            return;
+
+        xLETPorts[ uxPort ].pvBuffers[ xLETPorts[ uxPort ].uxBuffers ] = pvBuffer;
+        xLETPorts[ uxPort ].uxBuffers++;
+    }
+
+    /* Add a periodic task (already created) reading the port: its input is latched at every release */
+    void vLETPortAddReader( UBaseType_t uxPort, TaskHandle_t *pxReaderHandle ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxReaderHandle );
+        if( pxTCB == NULL || uxPort >= configMAX_LET_PORTS || xLETPorts[ uxPort ].pxWriter == NULL ||
+            xLETPorts[ uxPort ].uxReaders == configMAX_LET_READERS )
+            return;
+
+        xLETPorts[ uxPort ].pxReaders[ xLETPorts[ uxPort ].uxReaders ] = pxTCB;
+        xLETPorts[ uxPort ].uxReaders++;
+    }
+
+    /* Buffer to be written by the current job of the writer (NULL if the caller does not write the port) */
+    void *pvLETOutput( UBaseType_t uxPort ){
+        if( uxPort >= configMAX_LET_PORTS || xLETPorts[ uxPort ].pxWriter == NULL ||
+            *xLETPorts[ uxPort ].pxWriter->pxTaskHandle != xTaskGetCurrentTaskHandle() )
+            return NULL;
+        return xLETPorts[ uxPort ].pvBuffers[ xLETPorts[ uxPort ].uxWriting ];
+    }
+
+    /* Input latched by the caller at the release of its current job (NULL if the caller does not read the port) */
+    const void *pvLETInput( UBaseType_t uxPort ){
+        UBaseType_t i;
+        TaskHandle_t xCurrentTaskHandle = xTaskGetCurrentTaskHandle();
+
+        if( uxPort >= configMAX_LET_PORTS )
+            return NULL;
+        for( i = 0; i < xLETPorts[ uxPort ].uxReaders; i++ )
+            if( *xLETPorts[ uxPort ].pxReaders[ i ]->pxTaskHandle == xCurrentTaskHandle )
+                return xLETPorts[ uxPort ].pvLatched[ i ];
+        return NULL;
+    }
+#endif
+
+#if( configENABLE_ELASTIC == 1 )
+    /* Make a periodic task (already created) elastic: its period can be stretched from the nominal one up to xPeriodMax,
+     * taking a share of the overload proportional to uxElasticity (0 keeps the task rigid) */
+    void vPeriodicTaskSetElastic( TaskHandle_t *pxTaskHandle, TickType_t xPeriodMax, UBaseType_t uxElasticity ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL || xPeriodMax < pxTCB->xPeriodMin )
+            return;
+
+        pxTCB->xPeriodMax = xPeriodMax;
+        pxTCB->uxElasticity = uxElasticity;
+    }
+
+    /* Change the WCET of a periodic task at runtime (a client joining or leaving): the elastic periods are compressed or
+     * relaxed to the new load and each task applies its own at the next job boundary. A lighter WCET is used at once, a
+     * heavier one only after every stretched period is in use (no transient overload). pdFALSE if the load is refused */
+    BaseType_t xPeriodicTaskSetWCET( TaskHandle_t *pxTaskHandle, TickType_t xWCET ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        TickType_t xWCETOld;
+        BaseType_t xAdmitted;
+        if( pxTCB == NULL )
+            return pdFALSE;
+
+        // The periods in use are changed by the test: no job can complete meanwhile
+        vTaskSuspendAll();
+        xWCETOld = pxTCB->xWCETNext;
+        pxTCB->xWCETNext = xWCET;
+        xAdmitted = prvElasticCompute();
+        if( xAdmitted == pdFALSE ){
+            // The periods found for the old load stay pending
+            pxTCB->xWCETNext = xWCETOld;
+            prvElasticCompute();
+        }
+        // The shorter periods of a relaxation are applied at the boundaries anyway, after the lighter WCET
+        if( pxTCB->xWCETNext < pxTCB->xWCET )
+            pxTCB->xWCET = pxTCB->xWCETNext;
+        xTaskResumeAll();
+
+        printf( "\n[ELASTIC] Tick count %lu - Task %s - WCET %lu %s\n", xTaskGetTickCount(), pxTCB->pcName, xWCET,
+                ( xAdmitted == pdTRUE ) ? "admitted" : "refused - Periods unchanged" );
+        return xAdmitted;
+    }
+#endif
+
+#if( configENABLE_OVERLOAD == 1 )
+    /* Give a value to the jobs of a periodic task (already created), gained if they complete within xTolerance ticks
+     * after their deadline: under overload the jobs of least value are rejected first */
+    void vPeriodicTaskSetValue( TaskHandle_t *pxTaskHandle, UBaseType_t uxValue, TickType_t xTolerance ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL )
+            return;
+
+        pxTCB->uxValue = uxValue;
+        pxTCB->xTolerance = xTolerance;
+    }
+
+    /* Print the cumulative value achieved by the jobs and the value lost by the late and rejected ones */
+    void vOverloadReport(){
+        printf( "\n[OVERLOAD] Tick count %lu - Value achieved %lu - Lost late %lu - Lost rejected %lu (%lu jobs)\n",
+                xTaskGetTickCount(), uxValueAchieved, uxValueMissed, uxValueRejected, uxJobsRejected );
+    }
+#endif
+
+#if( configENABLE_PARTITIONS == 1 )
+    /* Create an empty partition served by a periodic resource: xBudget ticks every xPeriod ticks */
+    void vPartitionCreate( UBaseType_t uxPartition, const char *pcName, TickType_t xPeriod, TickType_t xBudget ){
+        cPartition_t *pxPartition;
+        if( uxPartition >= configMAX_PARTITIONS || xPartitions[ uxPartition ].xServer.pcName != NULL || xBudget == 0 ||
+            xBudget > xPeriod )
+            return;
+
+        pxPartition = &xPartitions[ uxPartition ];
+        pxPartition->xServer.pcName = pcName;
+        pxPartition->xServer.xPeriod = xPeriod;
+        pxPartition->xServer.xDeadline = xPeriod;
+        pxPartition->xServer.xWCET = xBudget;
+        pxPartition->xServer.xWCRT = xBudget;
+        pxPartition->xRemaining = xBudget;
+        pxPartition->xNextReplenish = xStartTime + xPeriod;
+        pxPartition->xExhausted = pdFALSE;
+        snprintf( pxPartition->cIdleName, configMAX_TASK_NAME_LEN, "Budget%u", ( unsigned short ) uxPartition );
+
+        // The reservations are sorted by period as the periodic tasks under RMS
+        vListInitialiseItem( &pxPartition->xServer.pxTCBItem );
+        listSET_LIST_ITEM_OWNER( &pxPartition->xServer.pxTCBItem, &pxPartition->xServer );
+        listSET_LIST_ITEM_VALUE( &pxPartition->xServer.pxTCBItem, xPeriod );
+        vListInsert( &xPartition_List, &pxPartition->xServer.pxTCBItem );
+    }
+
+    /* Move a periodic task (already created) to a partition: its jobs run only on the budget of the partition */
+    void vPartitionAddTask( UBaseType_t uxPartition, TaskHandle_t *pxTaskHandle ){
+        cTCB_t *pxTCB = prvGetTCBFromListByTaskHandle( pxTaskHandle );
+        if( pxTCB == NULL || uxPartition >= configMAX_PARTITIONS )
+            return;
+
+        pxTCB->uxPartition = uxPartition;
+    }
+#endif
+
+/* Personalized vTaskStartScheduler function for Real Time environment */
+void vTaskStartRealTimeScheduler(){
+    #if( configENABLE_SLACK_STEALING == 1 )
+        prvSlackStealerCreate();
+    #elif(configENABLE_APERIODIC == 1)
+        prvPollingServerInit();
+    #endif
+    #if( configENABLE_PARTITIONS == 1 )
+        prvPartitionAssignBands();
+    #endif
+    #if( configENABLE_RM == 1 )
+        #if( configENABLE_CHAINS == 1 && configCHAIN_TUNING == 1 )
+            prvChainTune();
+        #endif
+        #if( configENABLE_FIXED == 0)
+            prvAssignPriorityRMS();
+        #endif
+    #elif( configENABLE_EDF == 1 )
+        #if( configENABLE_POLICY_SELECT == 1 )
+            printf( "\nSCHEDULING POLICY %s\n", pxPolicy->pcName );
+            if( pxPolicy->pxAssignPriorities != NULL )
+                pxPolicy->pxAssignPriorities();
+            // The Scheduler Task is only needed by the dynamic priorities
+            if( pxPolicy->xDynamic == pdTRUE )
+                prvSchedulerEDFCreate();
+        #else
+            prvSetEDF();
+            prvSchedulerEDFCreate();
+        #endif
+    #endif
+    #if( configENABLE_SRP == 1 )
+        prvSetResourceCeilings();
+    #endif
+    #if( configENABLE_COROUTINES == 1 )
+        prvAssignPriorityCoRoutines();
+    #endif
+    #if( configENABLE_MK_FIRM == 1 )
+        prvSetOptionalBand();
+    #endif
+
+    #if( configENABLE_ELASTIC == 1 )
+        // An overloaded task set is compressed instead of refused (the RMS priorities stay the ones of the nominal periods)
+        if( prvElasticCompute() == pdTRUE )
+            prvElasticStart();
+        else printf( "\nELASTIC COMPRESSION FAILED - Overloaded even at the longest periods\n" );
+    #endif
+    #if( configENABLE_OVERHEADS == 0 && (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
+        #if( configENABLE_POLICY_SELECT == 1 )
+            // The priorities given by the user come without guarantee
+            if( pxPolicy->pxCheckBound != NULL && prvCheckFeasibility() == pdFALSE )
+                return;
+        #else
+            if( prvCheckFeasibility() == pdFALSE )
+                return;
+        #endif
+    #endif
+    #if( configENABLE_LET == 1 )
+        if( prvCheckLETPorts() == pdFALSE )
+            return;
+    #endif
+    prvCallTaskCreate();
+    #if( configENABLE_MIXED_CRITICALITY == 1 )
+        xTaskCreate( prvModeSwitchCode,
+                     "ModeSwitch",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xModeSwitchHandle);
+    #endif
+    #if( configENABLE_RECLAIMING == 1 )
+        xTaskCreate( prvBudgetCode,
+                     "Budget",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xBudgetHandle);
+    #endif
+    #if( configENABLE_MK_FIRM == 1 )
+        xTaskCreate( prvAbortCode,
+                     "Abort",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xAbortHandle);
+    #endif
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        xTaskCreate( prvThresholdReleaseCode,
+                     "Release",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xReleaseHandle);
+    #endif
+    #if( configENABLE_OVERHEADS == 1 )
+        // The feasibility is checked by the Calibration Task, once the overheads are measured on the running kernel
+        prvCalibrationCreate();
+    #endif
+    #if( configENABLE_PARTITIONS == 1 )
+        prvPartitionsCreate();
+    #endif
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        prvDualPriorityCreate();
+    #endif
+    #if( configENABLE_LIMITED_PREEMPTION == 1 )
+        xTaskCreate( prvNPRCode,
+                     "NPR",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xNPRHandle);
+    #endif
+    #if( configENABLE_COROUTINES == 1 )
+        prvCoRoutinesCreate();
+    #endif
+    xStartTime = xTaskGetTickCount();
+    #if( configENABLE_LET == 1 )
+        // The ports are latched at the first releases, before any job runs
+        prvLETStart();
+    #endif
+    vTaskStartScheduler();
+}
+
+/* Tick count on the 64-bit time base: it starts as the tick count of the kernel but never wraps */
+uint64_t ullGetTickCount64(){
+    uint64_t ullNow;
+    // Two words on a 32-bit core: the tick can not fall between their readings
+    taskENTER_CRITICAL();
+    ullNow = ullTickCount64;
+    taskEXIT_CRITICAL();
+    return ullNow;
+}
+
+#if( configENABLE_PROFILING == 1 )
+    /* Start the kernel running only the WCET profiling of the periodic tasks created so far */
+    void vTaskStartProfiling(){
+        xTaskCreate( prvProfilingCode,
+                     "Profiling",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     NULL);
+        vTaskStartScheduler();
+    }
+#endif
+
+#if( configENABLE_BENCHMARK == 1 )
+    /* Start the kernel running only the scheduler overhead benchmark */
+    void vTaskStartSchedulerBenchmark(){
+        #if( configENABLE_EDF == 1 )
+            prvSchedulerEDFCreate();
+        #endif
+        // The benchmark runs below the EDF scheduler so that the job notifications are served as at runtime
+        xTaskCreate( prvBenchmarkCode,
+                     "Benchmark",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO - 1,
+                     &xBenchmarkHandle);
+        vTaskStartScheduler();
+    }
+#endif
+/**
+ * ---------------------------------------------------------------------------------
+ */
+
+/**
+ * ---------------------------------------------------------------------------------
+ * Private Functions
+ */
+
+/*Hook function called in the System Tick Handler after any OS work is completed*/
+
+void vApplicationTickHook( void ){
+    prvTimeBaseTick();
+    #if( mainASSIGN_IP_DEMO == 1 )
+        return;
+    #endif
+    #if( configENABLE_LET == 1 )
+        // The instants of the Logical Execution Time come before the jobs released by this tick
+        prvLETTick( xTaskGetTickCountFromISR() );
+    #endif
+    TaskHandle_t xCurrentTaskHandle = xTaskGetCurrentTaskHandle();
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        // The group tasks execute the jobs of their members
+        cTCB_t *pxTask = prvGetTCBFromGroupByHandle(xCurrentTaskHandle);
+        if( pxTask != NULL )
+            pxTask->xTimeSpent++;
+    #elif( configENABLE_RM == 1 )
+        cTCB_t *pxTask = prvGetTCBFromListByHandleRMS(xCurrentTaskHandle);
+        if( pxTask != NULL && xCurrentTaskHandle != xTaskGetIdleTaskHandle())
+        {
+            pxTask->xTimeSpent++;
+            #if(configENABLE_APERIODIC == 1)
+                if(pxTask->xPS == pdTRUE)
+                    #if( configENABLE_RECLAIMING == 1 )
+                        // The reclaimed capacities are spent before the own budget
+                        prvServerCharge( pxTask );
+                    #else
+                        pxTask->xBudgetPS--;
+                    #endif
+            #endif
+            #if( configENABLE_MIXED_CRITICALITY == 1 )
+                // A HI task exceeding its LO budget switches the system to HI mode
+                if( xCriticalityMode == CRITICALITY_LO && pxTask->xCriticality == CRITICALITY_HI &&
+                    pxTask->xTimeSpent > pxTask->xWCET ){
+                    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+                    xCriticalityMode = CRITICALITY_HI;
+                    pxOverrunTask = pxTask;
+                    vTaskNotifyGiveFromISR( xModeSwitchHandle, &xHigherPriorityTaskWoken );
+                    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+                }
+            #endif
+            #if( configENABLE_LIMITED_PREEMPTION == 1 )
+                // A region reaching the NPR length is closed by the NPR Task
+                if( pxTask->xInNPR == pdTRUE && ++pxTask->xNPRTime == pxTask->xNPRLength ){
+                    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+                    vTaskNotifyGiveFromISR( xNPRHandle, &xHigherPriorityTaskWoken );
+                    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+                }
+            #endif
+        }
+    #elif( configENABLE_EDF == 1 )
+        cTCB_t *pxTask = prvGetTCBFromListByHandleEDF(xCurrentTaskHandle);
+        if( pxTask != NULL && xCurrentTaskHandle != xSchedulerEDFHandle && xCurrentTaskHandle != xTaskGetIdleTaskHandle())
+        {
+            pxTask->xTimeSpent++;
+            #if(configENABLE_APERIODIC == 1)
+                if(pxTask->xPS == pdTRUE)
+                    #if( configENABLE_RECLAIMING == 1 )
+                        // The reclaimed capacities are spent before the own budget
+                        prvServerCharge( pxTask );
+                    #else
+                        pxTask->xBudgetPS--;
+                    #endif
+            #endif
+        }
+    #endif
+    #if( configENABLE_PARTITIONS == 1 )
+        prvPartitionTick( xCurrentTaskHandle, pxTask );
+    #endif
+    #if( configENABLE_MK_FIRM == 1 )
+        // The optional jobs never run past their deadline, into the next release of the task
+        prvOptionalJobsTick( xTaskGetTickCountFromISR() );
+    #endif
+}
+
+/* Hook function called when the Idle Task is activated*/
+void vApplicationIdleHook( void ){
+    #if( configENABLE_MIXED_CRITICALITY == 1 )
+        BaseType_t xIdleBegins;
+
+        // The flag is read and set together, a job starting in between would hide the next idle period
+        taskENTER_CRITICAL();
+        xIdleBegins = ( xIdleFlag == 0 );
+        xIdleFlag = 1;
+        taskEXIT_CRITICAL();
+
+        // An idle instant is the chance to go back to LO mode, notified once when the idle period begins
+        if( xIdleBegins == pdTRUE && xCriticalityMode == CRITICALITY_HI && xModeSwitchHandle != NULL )
+            xTaskNotifyGive( xModeSwitchHandle );
+    #else
+        xIdleFlag = 1;
+    #endif
+    #if( configENABLE_COROUTINES == 1 )
+        // The co-routine jobs run in background of the periodic tasks, sharing the stack of the Idle Task
+        vCoRoutineSchedule();
+    #endif
+    #if( configENABLE_BACKGROUND == 1 )
+        // The rest of the idle time drains the background works, one chunk per call
+        prvBackgroundRunChunk();
+    #endif
+}
+
+#if( (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
+    /* Feasibility Test Standard*/
+    static BaseType_t prvCheckFeasibilitySTD( void ){
+        #if( configENABLE_RM == 1 )
+            if( prvCheckHyperbolicBound( pxTASK_List ) == pdFALSE ){
+                printf("\nU_max > 2\n");
+                return pdFALSE;
+            }
+
+        #elif( configENABLE_EDF == 1 && configENABLE_POLICY_SELECT == 1 )
+            if( pxPolicy->pxCheckBound != NULL && pxPolicy->pxCheckBound( pxTASK_List ) == pdFALSE ){
+                printf("\n%s\n", pxPolicy->pcBound);
+                return pdFALSE;
+            }
+        #elif( configENABLE_EDF == 1 )
+            if( prvCheckUtilisationBound( pxTASK_List ) == pdFALSE ){
+                printf("\nU_max > 1\n");
+                return pdFALSE;
+            }
+            #if( configENABLE_SRP == 1 )
+                if( prvCheckBlockingBoundEDF( pxTASK_List ) == pdFALSE ){
+                    printf("\nU_max + B/D > 1\n");
+                    return pdFALSE;
+                }
+            #endif
+        #endif
+
+        return pdTRUE;
+    }
+
+    #if( configENABLE_RM == 1 || configENABLE_GENERATOR == 1 || configENABLE_POLICY_SELECT == 1 )
+        /* Hyperbolic Bound for RMS: the product of all (U_i + 1) must not exceed 2 */
+        static BaseType_t prvCheckHyperbolicBound( List_t *pxList ){
+            float xU = 1.0;
+            float adder = 1.0;
+            #if( configENABLE_OVERHEADS == 1 )
+                // The tick interrupt is a task of period 1 with the highest priority
+                xU *= (float) ulOverheadTick / ulCyclesPerTick + adder;
+            #endif
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                xU *= (float) pxTCB->xWCET / pxTCB->xPeriod + adder ;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+            if( xU > 2.0 )
+                return pdFALSE;
+            return pdTRUE;
+        }
+    #endif
+
+    #if( configENABLE_EDF == 1 || configENABLE_GENERATOR == 1 )
+        /* Utilisation Bound for EDF: the total utilisation must not exceed 1 */
+        static BaseType_t prvCheckUtilisationBound( List_t *pxList ){
+            float xU = 0.0;
+            #if( configENABLE_OVERHEADS == 1 )
+                xU += (float) ulOverheadTick / ulCyclesPerTick;
+            #endif
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+            if( xU > 1.0 )
+                return pdFALSE;
+            return pdTRUE;
+        }
+    #endif
+
+    /* Run the feasibility tests of the algorithm enabled on the Task List (printing the results) */
+    static BaseType_t prvCheckFeasibility(){
+        BaseType_t xFeasible;
+        if( prvCheckFeasibilitySTD() == pdFALSE )
+            printf("\nSTANDARD FEASIBILITY TEST NOT PASSED\n");
+        #if( configENABLE_LIMITED_PREEMPTION == 1 )
+            // The regions of the lower priority tasks block the WCRT test
+            prvAssignNPRLengths();
+        #endif
+        #if( configENABLE_PARTITIONS == 1 )
+            xFeasible = prvCheckFeasibilityPartitions( pdTRUE );
+        #elif( configENABLE_PREEMPTION_THRESHOLD == 1 )
+            prvAssignThresholds();
+            xFeasible = prvCheckFeasibilityThreshold( pxTASK_List, pdTRUE );
+        #elif( configENABLE_MIXED_CRITICALITY == 1 )
+            xFeasible = prvCheckFeasibilityAMC( pxTASK_List, pdTRUE );
+        #elif( configENABLE_DUAL_PRIORITY == 1 )
+            xFeasible = prvCheckFeasibilityDualPriority( pdTRUE );
+        #elif( configENABLE_ARBITRARY_DEADLINE == 1 )
+            xFeasible = prvCheckFeasibilityBusyPeriod( pxTASK_List, pdTRUE );
+        #else
+            xFeasible = prvCheckFeasibilityWCRT( pxTASK_List, pdTRUE );
+        #endif
+        if( xFeasible == pdFALSE ){
+            #if( configENABLE_OVERLOAD == 1 )
+                // The overload manager keeps the jobs of highest value in time
+                printf( "\nFEASIBILITY WCRT TEST FAILED - The Task Set is overloaded - Jobs rejected by value\n\n");
+            #else
+                printf( "\nFEASIBILITY WCRT TEST FAILED - The Task Set is not schedulable - EXITING PROGRAM\n\n");
+                return pdFALSE;
+            #endif
+        }else printf("\nFEASIBILITY WCRT TEST PASSED\n");
+        #if( configENABLE_MK_FIRM == 1 )
+            prvPrintFirmPatterns();
+        #endif
+        #if( configENABLE_CHAINS == 1 )
+            if( prvCheckChains() == pdFALSE ){
+                printf( "\nEND-TO-END TEST FAILED - A chain misses its deadline - EXITING PROGRAM\n\n");
+                return pdFALSE;
+            }else printf("\nEND-TO-END TEST PASSED\n");
+        #endif
+        #if( configENABLE_COROUTINES == 1 )
+            if( prvCheckFeasibilityCoRoutines( pdTRUE ) == pdFALSE ){
+                printf( "\nCO-ROUTINE WCRT TEST FAILED - A co-routine job misses its deadline - EXITING PROGRAM\n\n");
+                return pdFALSE;
+            }else printf("\nCO-ROUTINE WCRT TEST PASSED\n");
+        #endif
+        return pdTRUE;
+    }
+
+    /* Feasibility Test with Worst Case Response Time on a list sorted by priority (each WCRT is printed if verbose)*/
+    static BaseType_t prvCheckFeasibilityWCRT( List_t *pxList, BaseType_t xVerbose ){
+        TickType_t xI;
+        cTCB_t *pxTCB;
+
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+        // Initialize R with WCET of the highest priority task
+        TickType_t xR = pxTCB->xWCET;
+        #if( configENABLE_SRP == 1 || configENABLE_LIMITED_PREEMPTION == 1 )
+            xR += pxTCB->xBlocking;
+            pxTCB->xWCRT = xR;
+        #endif
+        #if( configENABLE_OVERHEADS == 1 )
+            // Even the highest priority task is preempted by the tick interrupts
+            xI = xR;
+            while( xR <= pxTCB->xDeadline && xI + prvGetTickInterference( xR ) != xR )
+                xR = xI + prvGetTickInterference( xR );
+            pxTCB->xWCRT = xR;
+        #endif
+        if( xVerbose == pdTRUE )
+            printf("\nTask %s - WCET %lu - WCRT %lu\n", pxTCB->pcName, pxTCB->xWCET, pxTCB->xWCRT);
+
+        /*If the highest priority task has an execution time bigger than his deadline
+         * the schedulability is already not feasible */
+        if( pxTCB->xWCRT > pxTCB->xDeadline )
+            return pdFALSE;
+
+        // Take the next task
+        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+
+            // Start from C_i + B_i: R_(i-1) carries the blocking of the previous task and could overshoot the least fixed point
+            xR = pxTCB->xWCET;
+            #if( configENABLE_SRP == 1 || configENABLE_LIMITED_PREEMPTION == 1 )
+                xR += pxTCB->xBlocking;
+            #endif
+            // Do the test until R is not equal to the deadline (in RMS the deadline is equal to the period)
+            while( xR <= pxTCB->xDeadline ){
+                xI = 0;
+
+                // Traverse the list and take the other task not equal to the task examined according to highest priority
+                ListItem_t *pxTCB_HigherPriorityItem = listGET_HEAD_ENTRY( pxList );
+                do{
+                    cTCB_t *pxTCB_HigherPriority = listGET_LIST_ITEM_OWNER( pxTCB_HigherPriorityItem );
+                    #if( configENABLE_MK_FIRM == 1 )
+                        // Only the mandatory jobs interfere, the optional ones run in background
+                        xI = xI + ( prvGetMandatoryJobs( pxTCB_HigherPriority, CEIL( xR, pxTCB_HigherPriority->xPeriod ) ) *
+                                    pxTCB_HigherPriority->xWCET );
+                    #else
+                        xI = xI + ( CEIL( xR, pxTCB_HigherPriority->xPeriod ) * pxTCB_HigherPriority->xWCET );
+                    #endif
+                    pxTCB_HigherPriorityItem = listGET_NEXT( pxTCB_HigherPriorityItem );
+                }while( pxTCB_HigherPriorityItem != pxTCB_Pointer );
+
+                xI = xI + pxTCB->xWCET;
+                #if( configENABLE_SRP == 1 || configENABLE_LIMITED_PREEMPTION == 1 )
+                    // A lower priority task can block the task once, for one critical section or non-preemptive region
+                    xI = xI + pxTCB->xBlocking;
+                #endif
+                #if( configENABLE_OVERHEADS == 1 )
+                    xI = xI + prvGetTickInterference( xR );
+                #endif
+
+                // If R is equal to I examine the next task
+                if( xR == xI )
+                    break;
+                else
+                    xR = xI;
+            }
+
+            if( xR > pxTCB->xDeadline )
+                return pdFALSE;
+
+            // Update WCRT
+            pxTCB->xWCRT = xR;
+            if( xVerbose == pdTRUE )
+                printf("Task %s - WCET %lu - WCRT %lu\n", pxTCB->pcName, pxTCB->xWCET, pxTCB->xWCRT);
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+
+        return pdTRUE;
+    }
+
+    #if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+        /* Feasibility Test with the WCRT under preemption thresholds (each WCRT is printed if verbose) */
+        static BaseType_t prvCheckFeasibilityThreshold( List_t *pxList, BaseType_t xVerbose ){
+            cTCB_t *pxTCB;
+            TickType_t xR;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                xR = prvGetResponseTimeThreshold( pxList, pxTCB );
+                if( xR > pxTCB->xDeadline )
+                    return pdFALSE;
+
+                // Update WCRT
+                pxTCB->xWCRT = xR;
+                if( xVerbose == pdTRUE )
+                    printf("Task %s - WCET %lu - WCRT %lu - Priority %ld - Threshold %ld\n", pxTCB->pcName,
+                           pxTCB->xWCET, pxTCB->xWCRT, pxTCB->xPriority, pxTCB->xThreshold);
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return pdTRUE;
+        }
+
+        /* WCRT of a task under preemption thresholds (Wang-Saksena, Regehr): every job of the level-i busy period
+         * waits for its start time, then only the tasks with priority above the threshold can preempt it.
+         * portMAX_DELAY is returned as soon as a job misses its deadline */
+        static TickType_t prvGetResponseTimeThreshold( List_t *pxList, cTCB_t *pxTCB ){
+            cTCB_t *pxOther;
+            ListItem_t *pxOther_Pointer;
+            const ListItem_t *pxOther_Tail = listGET_END_MARKER( pxList );
+            TickType_t xB = 0;
+            TickType_t xL;
+            TickType_t xNext;
+            TickType_t xS;
+            TickType_t xF;
+            TickType_t xR = 0;
+            TickType_t xJobDeadline;
+            UBaseType_t uxJob;
+            UBaseType_t uxJobs;
+
+            // Blocking: longest lower priority job whose threshold does not let the task preempt it
+            for( pxOther_Pointer = listGET_HEAD_ENTRY( pxList ); pxOther_Pointer != pxOther_Tail;
+                 pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                if( pxOther->xPriority < pxTCB->xPriority && pxOther->xThreshold >= pxTCB->xPriority &&
+                    pxOther->xWCET > xB )
+                    xB = pxOther->xWCET;
+            }
+            #if( configENABLE_SRP == 1 )
+                // A job is blocked once, either by a lower priority job or by a critical section
+                if( pxTCB->xBlocking > xB )
+                    xB = pxTCB->xBlocking;
+            #endif
+
+            // Length of the level-i busy period
+            xL = xB + pxTCB->xWCET;
+            for( ; ; ){
+                xNext = xB;
+                for( pxOther_Pointer = listGET_HEAD_ENTRY( pxList ); pxOther_Pointer != pxOther_Tail;
+                     pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                    pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                    if( pxOther->xPriority >= pxTCB->xPriority )
+                        xNext += CEIL( xL, pxOther->xPeriod ) * pxOther->xWCET;
+                }
+                if( xNext == xL )
+                    break;
+                if( xNext > portMAX_DELAY / 2 )
+                    return portMAX_DELAY;
+                xL = xNext;
+            }
+            uxJobs = CEIL( xL, pxTCB->xPeriod );
+
+            for( uxJob = 0; uxJob < uxJobs; uxJob++ ){
+                xJobDeadline = uxJob * pxTCB->xPeriod + pxTCB->xDeadline;
+
+                // Start time: blocking, previous jobs and higher priority jobs released up to the start
+                xS = xB + uxJob * pxTCB->xWCET;
+                for( ; ; ){
+                    xNext = xB + uxJob * pxTCB->xWCET;
+                    for( pxOther_Pointer = listGET_HEAD_ENTRY( pxList ); pxOther_Pointer != pxOther_Tail;
+                         pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                        pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                        if( pxOther->xPriority > pxTCB->xPriority )
+                            xNext += ( xS / pxOther->xPeriod + 1 ) * pxOther->xWCET;
+                    }
+                    if( xNext == xS )
+                        break;
+                    if( xNext > xJobDeadline )
+                        return portMAX_DELAY;
+                    xS = xNext;
+                }
+
+                // Finish time: after the start only the jobs above the threshold released later can preempt
+                xF = xS + pxTCB->xWCET;
+                for( ; ; ){
+                    xNext = xS + pxTCB->xWCET;
+                    for( pxOther_Pointer = listGET_HEAD_ENTRY( pxList ); pxOther_Pointer != pxOther_Tail;
+                         pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                        pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                        if( pxOther->xPriority > pxTCB->xThreshold )
+                            xNext += ( CEIL( xF, pxOther->xPeriod ) - ( xS / pxOther->xPeriod + 1 ) ) * pxOther->xWCET;
+                    }
+                    if( xNext == xF )
+                        break;
+                    if( xNext > xJobDeadline )
+                        return portMAX_DELAY;
+                    xF = xNext;
+                }
+
+                if( xF > xJobDeadline )
+                    return portMAX_DELAY;
+                if( xF - uxJob * pxTCB->xPeriod > xR )
+                    xR = xF - uxJob * pxTCB->xPeriod;
+            }
+            return xR;
+        }
+
+        /* Assign the thresholds starting from the fully preemptive assignment: from the highest priority,
+         * raise each threshold as long as the task set stays schedulable (nothing is raised if the fully
+         * preemptive assignment is not schedulable) */
+        static void prvAssignThresholds(){
+            cTCB_t *pxTCB;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+            BaseType_t xMaxPriority = ( ( cTCB_t * ) listGET_LIST_ITEM_OWNER( pxTCB_Pointer ) )->xPriority;
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                pxTCB->xThreshold = pxTCB->xPriority;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            if( prvCheckFeasibilityWCRT( pxTASK_List, pdFALSE ) == pdFALSE )
+                return;
+
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                while( pxTCB->xThreshold < xMaxPriority ){
+                    pxTCB->xThreshold++;
+                    if( prvCheckFeasibilityThreshold( pxTASK_List, pdFALSE ) == pdFALSE ){
+                        pxTCB->xThreshold--;
+                        break;
+                    }
+                }
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        }
+    #endif
+
+    #if( configENABLE_GENERATOR == 1 || ( configENABLE_MULTICORE == 1 && configENABLE_EDF == 1 ) )
+        /* Processor Demand Criterion for EDF, checked with the Quick Processor-demand Analysis (QPA) */
+        static BaseType_t prvCheckProcessorDemandEDF( List_t *pxList ){
+            float xU = 0.0;
+            float xLa = 0.0;
+            TickType_t xDmin = portMAX_DELAY;
+            TickType_t xW = 0;
+            TickType_t xWNext;
+            TickType_t xL;
+            TickType_t xT;
+            TickType_t xH;
+            cTCB_t *pxTCB;
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            // Utilisation, smallest deadline and initial value of the synchronous busy period
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
+                xLa += ( (float) pxTCB->xPeriod - pxTCB->xDeadline ) * pxTCB->xWCET / pxTCB->xPeriod;
+                if( pxTCB->xDeadline < xDmin )
+                    xDmin = pxTCB->xDeadline;
+                xW += pxTCB->xWCET;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+            if( xU > 1.0 )
+                return pdFALSE;
+
+            // Bound La of the interval to check (only defined for U < 1)
+            if( xU < 1.0 ){
+                xLa = xLa / ( 1.0 - xU );
+                pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+                while( pxTCB_Pointer != pxTCB_Tail ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( (float) pxTCB->xDeadline - pxTCB->xPeriod > xLa )
+                        xLa = (float) pxTCB->xDeadline - pxTCB->xPeriod;
+                    pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                }
+            }
+
+            // Bound Lb: length of the synchronous busy period, not needed beyond La
+            for( ; ; ){
+                xWNext = 0;
+                pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+                while( pxTCB_Pointer != pxTCB_Tail ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    xWNext += CEIL( xW, pxTCB->xPeriod ) * pxTCB->xWCET;
+                    pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                }
+                if( xWNext == xW || ( xU < 1.0 && xWNext > xLa ) )
+                    break;
+                // U = 1 and the busy period does not fit the tick counter: not provable
+                if( xWNext > portMAX_DELAY / 2 )
+                    return pdFALSE;
+                xW = xWNext;
+            }
+
+            xL = xWNext;
+            if( xU < 1.0 && xLa < xWNext )
+                xL = ( TickType_t ) xLa + 1;
+
+            // Walk backwards from the last deadline before L, jumping to h(t) whenever h(t) < t
+            xT = prvGetDeadlineBefore( pxList, xL );
+            xH = prvGetProcessorDemand( pxList, xT );
+            while( xH <= xT && xH > xDmin ){
+                if( xH < xT )
+                    xT = xH;
+                else
+                    xT = prvGetDeadlineBefore( pxList, xT );
+                xH = prvGetProcessorDemand( pxList, xT );
+            }
+
+            if( xH <= xDmin )
+                return pdTRUE;
+            return pdFALSE;
+        }
+
+        /* Demand h(t) of all the jobs with release and deadline inside [0, t] */
+        static TickType_t prvGetProcessorDemand( List_t *pxList, TickType_t xT ){
+            TickType_t xH = 0;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xDeadline <= xT )
+                    xH += ( ( xT - pxTCB->xDeadline ) / pxTCB->xPeriod + 1 ) * pxTCB->xWCET;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return xH;
+        }
+
+        /* Latest absolute deadline strictly before t (0 if there is none) */
+        static TickType_t prvGetDeadlineBefore( List_t *pxList, TickType_t xT ){
+            TickType_t xD = 0;
+            TickType_t xDTask;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xDeadline < xT ){
+                    xDTask = ( ( xT - 1 - pxTCB->xDeadline ) / pxTCB->xPeriod ) * pxTCB->xPeriod + pxTCB->xDeadline;
+                    if( xDTask > xD )
+                        xD = xDTask;
+                }
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return xD;
+        }
+    #endif
+
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        /* Feasibility Test for dual-priority scheduling: the soft tasks never delay a promoted job, so only the hard
+         * tasks take part in the WCRT test, and each promotion time is D - R (printed if verbose) */
+        static BaseType_t prvCheckFeasibilityDualPriority( BaseType_t xVerbose ){
+            List_t xSoft_List;
+            cTCB_t *pxTCB;
+            ListItem_t *pxNext;
+            UBaseType_t uxHard = 0, uxSoft = 0;
+            BaseType_t xFeasible = pdTRUE;
+
+            // Move the soft tasks aside for the test
+            vListInitialise( &xSoft_List );
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != listGET_END_MARKER( pxTASK_List ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                pxNext = listGET_NEXT( pxTCB_Pointer );
+                if( pxTCB->xSoft == pdTRUE ){
+                    uxListRemove( pxTCB_Pointer );
+                    vListInsert( &xSoft_List, pxTCB_Pointer );
+                    uxSoft++;
+                }else
+                    uxHard++;
+                pxTCB_Pointer = pxNext;
+            }
+
+            // Every hard task has a priority in both the upper and the lower band
+            if( 2 * uxHard + uxSoft > configSCHED_PRIO - 1 ){
+                if( xVerbose == pdTRUE )
+                    printf("\nNot enough priorities: %lu hard and %lu soft tasks\n", uxHard, uxSoft);
+                xFeasible = pdFALSE;
+            }else if( uxHard > 0 )
+                xFeasible = prvCheckFeasibilityWCRT( pxTASK_List, xVerbose );
+
+            if( xFeasible == pdTRUE ){
+                pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+                while( pxTCB_Pointer != listGET_END_MARKER( pxTASK_List ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    pxTCB->xPromotion = pxTCB->xDeadline - pxTCB->xWCRT;
+                    if( xVerbose == pdTRUE )
+                        printf("Task %s - Promotion %lu - Priority %ld (%ld before promotion)\n", pxTCB->pcName,
+                               pxTCB->xPromotion, pxTCB->xPriority, pxTCB->xLowPriority);
+                    pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                }
+            }
+
+            // Put the soft tasks back
+            while( listLIST_IS_EMPTY( &xSoft_List ) == pdFALSE ){
+                pxTCB_Pointer = listGET_HEAD_ENTRY( &xSoft_List );
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( xVerbose == pdTRUE && xFeasible == pdTRUE )
+                    printf("Task %s - Soft - Priority %ld\n", pxTCB->pcName, pxTCB->xPriority);
+                uxListRemove( pxTCB_Pointer );
+                vListInsert( pxTASK_List, pxTCB_Pointer );
+            }
+
+            return xFeasible;
+        }
+    #endif
+
+    #if( configENABLE_ARBITRARY_DEADLINE == 1 )
+        /* Feasibility Test for arbitrary deadlines (D > T): the WCRT test bounds the first job of each task, then
+         * every job of the level-i busy period is checked (each WCRT is printed if verbose) */
+        static BaseType_t prvCheckFeasibilityBusyPeriod( List_t *pxList, BaseType_t xVerbose ){
+            cTCB_t *pxTCB;
+            UBaseType_t uxJobs;
+            float xU = 0.0;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+            if( prvCheckFeasibilityWCRT( pxList, pdFALSE ) == pdFALSE )
+                return pdFALSE;
+            #if( configENABLE_OVERHEADS == 1 )
+                // The tick interrupt is a task of period 1 with the highest priority
+                xU = (float) ulOverheadTick / ulCyclesPerTick;
+            #endif
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                // The level-i busy period never ends if the utilisation of the level exceeds 1
+                xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
+                if( xU > 1.0 )
+                    return pdFALSE;
+
+                pxTCB->xWCRT = prvGetResponseTimeBusyPeriod( pxList, pxTCB_Pointer, &uxJobs );
+                if( pxTCB->xWCRT > pxTCB->xDeadline )
+                    return pdFALSE;
+                if( xVerbose == pdTRUE )
+                    printf("Task %s - WCET %lu - WCRT %lu - Jobs in the busy period %lu\n", pxTCB->pcName, pxTCB->xWCET,
+                           pxTCB->xWCRT, uxJobs);
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return pdTRUE;
+        }
+
+        /* Longest response time among the jobs of the level-i busy period (stops as soon as a deadline is missed) */
+        static TickType_t prvGetResponseTimeBusyPeriod( List_t *pxList, ListItem_t *pxItem, UBaseType_t *puxJobs ){
+            cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+            cTCB_t *pxHigherPriority;
+            ListItem_t *pxHigherPriority_Pointer;
+            TickType_t xB = 0;
+            TickType_t xL = pxTCB->xWCET;
+            TickType_t xW = 0;
+            TickType_t xR = 0;
+            TickType_t xNext;
+            UBaseType_t uxJob;
+
+            #if( configENABLE_SRP == 1 )
+                xB = pxTCB->xBlocking;
+            #endif
+
+            // Length of the level-i busy period
+            for( ; ; ){
+                xNext = xB + CEIL( xL, pxTCB->xPeriod ) * pxTCB->xWCET;
+                for( pxHigherPriority_Pointer = listGET_HEAD_ENTRY( pxList ); pxHigherPriority_Pointer != pxItem;
+                     pxHigherPriority_Pointer = listGET_NEXT( pxHigherPriority_Pointer ) ){
+                    pxHigherPriority = listGET_LIST_ITEM_OWNER( pxHigherPriority_Pointer );
+                    xNext += CEIL( xL, pxHigherPriority->xPeriod ) * pxHigherPriority->xWCET;
+                }
+                #if( configENABLE_OVERHEADS == 1 )
+                    xNext += prvGetTickInterference( xL );
+                #endif
+                if( xNext == xL )
+                    break;
+                xL = xNext;
+            }
+            *puxJobs = CEIL( xL, pxTCB->xPeriod );
+
+            // Finishing time of the job q: the q previous jobs of the task are queued before it
+            for( uxJob = 0; uxJob < *puxJobs; uxJob++ ){
+                xW += pxTCB->xWCET;
+                for( ; ; ){
+                    xNext = xB + ( uxJob + 1 ) * pxTCB->xWCET;
+                    for( pxHigherPriority_Pointer = listGET_HEAD_ENTRY( pxList ); pxHigherPriority_Pointer != pxItem;
+                         pxHigherPriority_Pointer = listGET_NEXT( pxHigherPriority_Pointer ) ){
+                        pxHigherPriority = listGET_LIST_ITEM_OWNER( pxHigherPriority_Pointer );
+                        xNext += CEIL( xW, pxHigherPriority->xPeriod ) * pxHigherPriority->xWCET;
+                    }
+                    #if( configENABLE_OVERHEADS == 1 )
+                        xNext += prvGetTickInterference( xW );
+                    #endif
+                    if( xNext == xW )
+                        break;
+                    xW = xNext;
+                }
+                // Response time from the nominal release of the job
+                if( xW - uxJob * pxTCB->xPeriod > xR )
+                    xR = xW - uxJob * pxTCB->xPeriod;
+                if( xR > pxTCB->xDeadline )
+                    break;
+            }
+            return xR;
+        }
+    #endif
+#endif
+
+#if( configENABLE_PREEMPTION_THRESHOLD == 0 )
+/* Wrapper function calling all Task Code functions to execute them*/
+static void prvPeriodicTaskMaster( void *pvParameters ){
+    TaskHandle_t xCurrentTaskHandle = xTaskGetCurrentTaskHandle();
+    #if( configENABLE_RM == 1 )
+        cTCB_t *pxTask = prvGetTCBFromListByHandleRMS(xCurrentTaskHandle);
+    #elif( configENABLE_EDF == 1 )
+        cTCB_t *pxTask = prvGetTCBFromListByHandleEDF(xCurrentTaskHandle);
+    #endif
+
+    #if( configENABLE_MK_FIRM == 1 )
+        // Restarted after an abort: the next job is the one following the aborted job
+        if( pxTask->xAborted == pdTRUE ){
+            pxTask->xAborted = pdFALSE;
+            vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+        }
+        else
+    #endif
+    #if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+        // The sporadic (and event-triggered) tasks wait for their first arrival
+        if( pxTask->xArrivalQueue != NULL )
+            prvSporadicWaitRelease( pxTask, pdTRUE );
+        else
+    #endif
+    if ( pxTask->xArrivalTime != 0 )
+        vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xArrivalTime );
+    else
+        pxTask->xLastWakeTime = xStartTime;
+
+    for ( ; ; )
+    {
+        #if( configENABLE_MIXED_CRITICALITY == 1 )
+            // In HI mode the jobs of the LO tasks are dropped
+            if( xCriticalityMode == CRITICALITY_HI && pxTask->xCriticality == CRITICALITY_LO ){
+                printf( "\n[DROPPED] Tick count %lu - Task %s - LastWakeTime %lu\n", xTaskGetTickCount(), pxTask->pcName,
+                        pxTask->xLastWakeTime );
+                vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+                continue;
+            }
+        #endif
+        #if( configENABLE_MK_FIRM == 1 )
+            BaseType_t xMandatory = prvIsMandatoryJob( pxTask );
+            if( xMandatory == pdFALSE ){
+                // Overload: the optional job can not meet its deadline anymore, skip it
+                if( xTaskGetTickCount() - pxTask->xLastWakeTime + pxTask->xWCET > pxTask->xDeadline ){
+                    printf( "\n[SKIPPED] Tick count %lu - Task %s - LastWakeTime %lu - Distance %lu\n", xTaskGetTickCount(),
+                            pxTask->pcName, pxTask->xLastWakeTime, prvGetDistanceToFailure( pxTask ) );
+                    prvRecordJobOutcome( pxTask, pdFALSE );
+                    vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+                    continue;
+                }
+                // The optional jobs run below all the mandatory ones (closest to a failure first), until their deadline at most
+                vTaskPrioritySet( NULL, prvGetOptionalPriority( pxTask ) );
+                pxTask->xOptional = pdTRUE;
+            }
+        #endif
+        #if( configENABLE_OVERLOAD == 1 )
+            // Transient overload: the jobs of least value are rejected before they start
+            if( prvOverloadCheck( pxTask ) == pdTRUE ){
+                prvOverloadReject( pxTask );
+                vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+                continue;
+            }
+        #endif
+        TickType_t xStartTick = xTaskGetTickCount();
+        #if( configENABLE_ARBITRARY_DEADLINE == 1 )
+            // vTaskDelayUntil keeps the nominal releases: the jobs released while this one was waiting are queued
+            if( xStartTick - pxTask->xLastWakeTime >= pxTask->xPeriod )
+                printf( "\n[BACKLOG] Tick count %lu - Task %s - LastWakeTime %lu - %lu jobs pending\n", xStartTick,
+                        pxTask->pcName, pxTask->xLastWakeTime, ( xStartTick - pxTask->xLastWakeTime ) / pxTask->xPeriod + 1 );
+        #endif
+        #if( configENABLE_SPORADIC == 1 )
+            if( pxTask->uxRejected > 0 ){
+                UBaseType_t uxRejected;
+                taskENTER_CRITICAL();
+                uxRejected = pxTask->uxRejected;
+                pxTask->uxRejected = 0;
+                taskEXIT_CRITICAL();
+                printf( "\n[REJECTED] Tick count %lu - Task %s - %lu arrivals rejected\n", xStartTick, pxTask->pcName, uxRejected );
+            }
+        #endif
+        if( xIdleFlag == 1){
+            printf("\n--------*[IDLE]*--------");
+            xIdleFlag=0;
+        }
+        printf("\n------------------------------------------------------------------------------");
+        #if( configENABLE_LIMITED_PREEMPTION == 1 )
+            prvCountPreemption( pxTask, xStartTick );
+        #endif
+        prvJobEntry( pxTask );
+        #if( configENABLE_LIMITED_PREEMPTION == 1 && configLP_FIXED_POINTS == 1 )
+            // The job can only be preempted at its preemption points
+            prvNPREnter( pxTask );
+        #endif
+        #if( configENABLE_EDF == 1)
+            printf( "\nTick Count %lu Task %s lastWakeTime %lu Abs deadline %lu Priority %ld\n",
+                    xStartTick, pxTask->pcName, pxTask->xLastWakeTime, ( TickType_t ) pxTask->ullAbsDeadline, pxTask->xPriority);
+        #endif
+        #if( configENABLE_RM == 1 )
+            printf( "\n[START] Tick count %lu - Task %s - LastWakeTime %lu - Priority %ld \n", xStartTick, pxTask->pcName,
+                    pxTask->xLastWakeTime, pxTask->xPriority );
+        #endif
+        pxTask->pxTaskCode( pvParameters );
+        #if( configENABLE_MK_FIRM == 1 )
+            // Completed (or given up) before the Abort Task could restart it
+            BaseType_t xAborted;
+            taskENTER_CRITICAL();
+            pxTask->xOptional = pdFALSE;
+            xAborted = pxTask->xAborted;
+            pxTask->xAborted = pdFALSE;
+            taskEXIT_CRITICAL();
+            if( xAborted == pdTRUE )
+                printf( "\n[ABORTED] Tick count %lu - Task %s - LastWakeTime %lu - Distance %lu\n", xTaskGetTickCount(),
+                        pxTask->pcName, pxTask->xLastWakeTime, prvGetDistanceToFailure( pxTask ) );
+        #endif
+        printf( "\n[END] Execution time %lu (WCET: %lu) - Task %s\r\n", pxTask->xTimeSpent, pxTask->xWCET, pxTask->pcName );
+        #if( configENABLE_ARBITRARY_DEADLINE == 1 )
+            if( xTaskGetTickCount() - pxTask->xLastWakeTime > pxTask->xDeadline )
+                printf( "\n[DEADLINE MISS] Tick count %lu - Task %s - Deadline %lu\n", xTaskGetTickCount(), pxTask->pcName,
+                        pxTask->xLastWakeTime + pxTask->xDeadline );
+        #endif
+        #if( configENABLE_MK_FIRM == 1 )
+            // A job that gave up counts as missed
+            prvRecordJobOutcome( pxTask, xAborted == pdFALSE &&
+                                         xTaskGetTickCount() - pxTask->xLastWakeTime <= pxTask->xDeadline );
+            if( xMandatory == pdFALSE )
+                vTaskPrioritySet( NULL, pxTask->xPriority );
+        #endif
+        prvJobExit( pxTask );
+        #if( configENABLE_LIMITED_PREEMPTION == 1 )
+            // Close the region left open by the job
+            prvNPRExit( pxTask );
+        #endif
+
+        #if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+            if( pxTask->xArrivalQueue != NULL ){
+                prvSporadicWaitRelease( pxTask, pdFALSE );
+                continue;
+            }
+        #endif
+        vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+
+    }
+}
+#endif
+
+/* Extend the tick count to 64 bits: called by the TickHook once per tick, also while the scheduler is suspended */
+static void prvTimeBaseTick(){
+    ullTickCount64++;
+}
+
+/* Scheduler bookkeeping done at the release of every job */
+static void prvJobEntry( cTCB_t *pxTask ){
+    #if( configENABLE_EDF == 1)
+        prvNotifySchedulerEDF();
+    #endif
+    pxTask->xTaskJobStatus = pdFALSE;
+}
+
+/* Scheduler bookkeeping done at the completion of every job */
+static void prvJobExit( cTCB_t *pxTask ){
+    pxTask->xTaskJobStatus = pdTRUE;
+    #if( configENABLE_MIXED_CRITICALITY == 1 )
+        // A LO job completed in background may be the last one keeping the system in HI mode
+        if( xCriticalityMode == CRITICALITY_HI && pxTask->xCriticality == CRITICALITY_LO )
+            xTaskNotifyGive( xModeSwitchHandle );
+    #endif
+    #if( configENABLE_LET == 1 )
+        // A job completed after its deadline finds its outputs already skipped by the TickHook
+        if( xTaskGetTickCount() - pxTask->xLastWakeTime >= pxTask->xDeadline )
+            printf( "\n[LET] Tick count %lu - Task %s late - Outputs not published\n", xTaskGetTickCount(), pxTask->pcName );
+        else pxTask->xLETDone = pdTRUE;
+    #endif
+    #if( configENABLE_RECLAIMING == 1 )
+        // The budget left by an early completion can be used by the Polling Server up to the deadline of the job
+        prvCapacityRelease( pxTask );
+    #endif
+    pxTask->xTimeSpent = 0;
+    #if( configENABLE_ELASTIC == 1 )
+        // The next release is the first one with the new period
+        prvElasticApply( pxTask );
+    #endif
+
+    #if( configENABLE_DUAL_PRIORITY == 1 )
+        if( pxTask->xSoft == pdFALSE ){
+            // A job completed before its promotion skips it: the next one is promoted at its own release plus D - R
+            taskENTER_CRITICAL();
+            if( pxTask->xNextPromotion == pxTask->xLastWakeTime + pxTask->xPromotion )
+                pxTask->xNextPromotion += pxTask->xPeriod;
+            taskEXIT_CRITICAL();
+            vTaskPrioritySet( NULL, pxTask->xLowPriority );
+        }
+    #endif
+
+    #if( configENABLE_OVERLOAD == 1 )
+        if( ullGetTickCount64() <= pxTask->ullAbsDeadline + pxTask->xTolerance )
+            uxValueAchieved += pxTask->uxValue;
+        else{
+            uxValueMissed += pxTask->uxValue;
+            printf( "\n[OVERLOAD] Tick count %lu - Task %s late - Value %lu lost\n", xTaskGetTickCount(), pxTask->pcName,
+                    pxTask->uxValue );
+        }
+    #endif
+
+    #if( configENABLE_EDF == 1 )
+        // The next release is close to now, so the wrap of the tick count is resolved on the 64-bit time base
+        pxTask->ullAbsDeadline = prvExtendTime( pxTask->xLastWakeTime + pxTask->xPeriod ) + pxTask->xDeadline;
+        // Notify scheduler that the task has been executed and update priorities
+        prvNotifySchedulerEDF();
+    #endif
+
+    #if( configENABLE_SLACK_STEALING == 1 )
+        pxTask->xJobRelease += pxTask->xPeriod;
+        // The completed job releases the slack of its level: wake up the Slack Stealer if work is waiting
+        if( xSlackStealerHandle != NULL && listLIST_IS_EMPTY( pxAperiodicTASK_List ) == pdFALSE )
+            xTaskNotifyGive( xSlackStealerHandle );
+    #endif
+
+    #if( configENABLE_CHAINS == 1 )
+        // Signal an arrival to every task triggered by this one
+        TickType_t xNow = xTaskGetTickCount();
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->pxTrigger == pxTask )
+                xQueueSend( pxTCB->xArrivalQueue, &xNow, 0 );
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    #endif
+}
+
+/* Create all tasks traversing the Task List*/
+static void prvCallTaskCreate(){
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+    // The tasks that never preempt each other share the same FreeRTOS task
+    prvCreateThresholdGroups();
+#else
+    cTCB_t *pxTCB;
+
+    ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+    const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+    while( pxTCB_Pointer != pxTCB_Tail ){
+        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+        xTaskCreate( prvPeriodicTaskMaster,
+                     pxTCB->pcName,
+                     pxTCB->ulStackDepth,
+                     pxTCB->pvParameters,
+                     #if( configENABLE_DUAL_PRIORITY == 1 )
+                         // The hard tasks start in the lower band
+                         pxTCB->xLowPriority,
+                     #else
+                         pxTCB->xPriority,
+                     #endif
+                     pxTCB->pxTaskHandle);
+        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+    }
+#endif
+}
+
+#if( configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 || configENABLE_CHAINS == 1 || \
+     configENABLE_SPORADIC == 1 || configENABLE_PARTITIONS == 1 || configENABLE_DUAL_PRIORITY == 1 || configENABLE_LET == 1 || \
+     configENABLE_ELASTIC == 1 || configENABLE_OVERLOAD == 1 || configENABLE_FIRM_APERIODIC == 1 )
+    /* Return TCB from the Task List by the pointer to the Task Handle given at creation */
+    static cTCB_t *prvGetTCBFromListByTaskHandle( TaskHandle_t *pxTaskHandle ){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->pxTaskHandle == pxTaskHandle )
+                return pxTCB;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return NULL;
+    }
+#endif
+/**
+ * ---------------------------------------------------------------------------------
+ */
+
+/**
+ * ---------------------------------------------------------------------------------
+ * Functions by Category
+ */
+
+#if( configENABLE_RM == 1 )
+    /* Initialize TCB Item and insert it in Task List */
+    static void prvInitialiseTCBItemRMS( cTCB_t *pxTCB ) {
+        /* Initialize container to null so the item
+         * does not think that it is already contained in a list*/
+        vListInitialiseItem( &pxTCB->pxTCBItem );
+        // The owner of a list item is the object (usually a TCB) that contains the list item
+        listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
+        // The list is sorted in ascending order by period value
+        listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xPeriod);
+
+        // Insert Item in Task List
+        vListInsert( pxTASK_List, &pxTCB->pxTCBItem );
+    }
+
+    #if( configENABLE_PREEMPTION_THRESHOLD == 0 )
+    /* Return TCB from the Task List by Task Handle */
+    static cTCB_t *prvGetTCBFromListByHandleRMS(TaskHandle_t xTaskHandle){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if ( strcmp(pxTCB->pcName, pcTaskGetName(xTaskHandle)) == 0 )
+                return pxTCB;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return NULL;
+    }
+    #endif
+
+    #if(configENABLE_FIXED == 0)
+        /* Assign a priori Task's priority traversing the Sorted List */
+        static void prvAssignPriorityRMS() {
+            cTCB_t *pxTCB;
+            #if( configENABLE_PARTITIONS == 1 )
+                // Rank of the next task inside the band of each partition
+                UBaseType_t uxRank[ configMAX_PARTITIONS ] = { 0 };
+            #elif( configENABLE_DUAL_PRIORITY == 1 )
+                // Upper band of the promoted hard jobs, middle band of the soft tasks, lower band of the hard jobs
+                UBaseType_t xHighestPriority = configSCHED_PRIO - 1;
+                UBaseType_t xSoftPriority = xHighestPriority;
+                UBaseType_t xLowPriority;
+
+                ListItem_t *pxHard_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+                while( pxHard_Pointer != listGET_END_MARKER( pxTASK_List ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxHard_Pointer );
+                    if( pxTCB->xSoft == pdFALSE )
+                        xSoftPriority--;
+                    pxHard_Pointer = listGET_NEXT( pxHard_Pointer );
+                }
+                xLowPriority = xSoftPriority;
+                pxHard_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+                while( pxHard_Pointer != listGET_END_MARKER( pxTASK_List ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxHard_Pointer );
+                    if( pxTCB->xSoft == pdTRUE )
+                        xLowPriority--;
+                    pxHard_Pointer = listGET_NEXT( pxHard_Pointer );
+                }
+            #else
+                // Set priority of tasks starting by the max task priority - 1
+                UBaseType_t xHighestPriority = configMAX_PRIORITIES - 1;
+                #if( configENABLE_SLACK_STEALING == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_MIXED_CRITICALITY == 1 )
+                    // The Slack Stealer, the Release Task and the Mode Switch Task run above every periodic task
+                    xHighestPriority = configSCHED_PRIO - 1;
+                #elif( configENABLE_LIMITED_PREEMPTION == 1 )
+                    // The NPR Task and then the jobs inside a non-preemptive region run above every periodic task
+                    xHighestPriority = configSCHED_PRIO - 2;
+                #endif
+            #endif
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                // Set the priority from higher to lower since the list is sorted by ascending periods
+                #if( configENABLE_PARTITIONS == 1 )
+                    // Local RMS inside the band of the partition
+                    pxTCB->xPriority = xPartitions[ pxTCB->uxPartition ].xServer.xPriority - uxRank[ pxTCB->uxPartition ];
+                    uxRank[ pxTCB->uxPartition ]++;
+                #elif( configENABLE_DUAL_PRIORITY == 1 )
+                    // RMS order inside every band
+                    if( pxTCB->xSoft == pdTRUE ){
+                        pxTCB->xPriority = xSoftPriority;
+                        pxTCB->xLowPriority = xSoftPriority;
+                        xSoftPriority--;
+                    }else{
+                        pxTCB->xPriority = xHighestPriority;
+                        pxTCB->xLowPriority = xLowPriority;
+                        xHighestPriority--;
+                        xLowPriority--;
+                    }
+                #else
+                    pxTCB->xPriority = xHighestPriority;
+                    xHighestPriority--;
+                #endif
+
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        }
+    #endif
+#endif
+
+#if( configENABLE_EDF == 1 )
+    /* Assign priority traversing the Sorted List */
+    static void prvSetEDF(){
+        cTCB_t *pxTCB;
+        #if( configENABLE_PARTITIONS == 1 )
+            // Rank of the next task inside the band of each partition
+            UBaseType_t uxRank[ configMAX_PARTITIONS ] = { 0 };
+        #else
+            // Set priority of tasks starting by the scheduler priority - 1
+            UBaseType_t xHighestPriority = configSCHED_PRIO - 1;
+        #endif
+
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            // Set the priority from higher to lower since the list is sorted by ascending deadlines
+            #if( configENABLE_PARTITIONS == 1 )
+                // Local EDF inside the band of the partition
+                pxTCB->xPriority = xPartitions[ pxTCB->uxPartition ].xServer.xPriority - uxRank[ pxTCB->uxPartition ];
+                uxRank[ pxTCB->uxPartition ]++;
+            #else
+                pxTCB->xPriority = xHighestPriority;
+                xHighestPriority--;
+            #endif
+
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
+
+    /* Swap lists */
+    static void prvSwap( List_t **ppxList1, List_t **ppxList2 ){
+		List_t *pxList_tmp;
+			pxList_tmp = *ppxList1;
+			*ppxList1 = *ppxList2;
+			*ppxList2 = pxList_tmp;
+    }
+
+    /* Assign new priorities to tasks based on their new absolute deadlines */
+    static void prvCheckPrioritiesEDF(){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        ListItem_t *pxTCB_Pointer_tmp;
+        uint64_t ullNow = ullGetTickCount64();
+
+        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+
+            // Sort again the list by the new task's deadlnine (time left to the updated absolute deadline)
+            listSET_LIST_ITEM_VALUE( pxTCB_Pointer , prvGetDeadlineKey( pxTCB, ullNow ) );
+
+            // Update list removing the previous on temp list and swapping
+            pxTCB_Pointer_tmp = pxTCB_Pointer;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            uxListRemove( pxTCB_Pointer->pxPrevious );
+
+            vListInsert( pxTASK_List_tmp, pxTCB_Pointer_tmp );
+        }
+
+        prvSwap( &pxTASK_List, &pxTASK_List_tmp);
+        #if( configENABLE_PARTITIONS == 1 )
+            // Rank of the next task inside the band of each partition
+            UBaseType_t uxRank[ configMAX_PARTITIONS ] = { 0 };
+        #else
+            // Update highest priority
+            BaseType_t xHighestPriority = configSCHED_PRIO - 1;
+        #endif
+
+        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            #if( configENABLE_PARTITIONS == 1 )
+                // Local EDF inside the band of the partition, the tasks of an exhausted partition run in background
+                if( xPartitions[ pxTCB->uxPartition ].xExhausted == pdTRUE )
+                    pxTCB->xPriority = tskIDLE_PRIORITY;
+                else
+                    pxTCB->xPriority = xPartitions[ pxTCB->uxPartition ].xServer.xPriority - uxRank[ pxTCB->uxPartition ];
+                uxRank[ pxTCB->uxPartition ]++;
+            #else
+                pxTCB->xPriority = xHighestPriority;
+                xHighestPriority--;
+            #endif
+            // Set the new updated priority to the target task
+            vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+
+        #if( configENABLE_SRP == 1 )
+            if( xSystemCeiling >= 0 )
+                prvApplySystemCeilingEDF();
+        #endif
+    }
+
+    /* EDF Scheduler function code */
+    static void prvSchedulerEDFCode(){
+        for( ; ; ){
+            prvCheckPrioritiesEDF();
+            // Unblock target task
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        }
+    }
+
+    /* Create EDF Scheduler Task */
+    static void prvSchedulerEDFCreate(){
+        xTaskCreate( prvSchedulerEDFCode,
+                     "SchedulerEDF",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xSchedulerEDFHandle);
+    }
+
+    /* Return TCB from the Task List by Task Handle */
+    static cTCB_t *prvGetTCBFromListByHandleEDF(TaskHandle_t xTaskHandle){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if ( strcmp(pxTCB->pcName, pcTaskGetName(xTaskHandle)) == 0 )
+                return pxTCB;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return NULL;
+    }
+
+    /* Initialize TCB Item and insert it in Task List */
+    static void prvInitialiseTCBItemEDF( cTCB_t *pxTCB ){
+        vListInitialiseItem( &pxTCB->pxTCBItem );
+        // The owner of a list item is the object (usually a TCB) that contains the list item
+        listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
+        #if( configENABLE_POLICY_SELECT == 1 )
+            // The list is sorted in ascending order by the key of the policy
+            listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxPolicy->pxGetKey( pxTCB ) );
+        #else
+            // The list is sorted in ascending order by deadline value
+            listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, prvGetDeadlineKey( pxTCB, ullGetTickCount64() ) );
+        #endif
+
+        // Insert in global list
+        vListInsert( pxTASK_List, &pxTCB->pxTCBItem );
+    }
+
+    /* Call the EDF Scheduler Task */
+    static void prvNotifySchedulerEDF(){
+        BaseType_t xHigherPriorityTaskWoken;
+        #if( configENABLE_POLICY_SELECT == 1 )
+            // The static priorities never change
+            if( pxPolicy->xDynamic == pdFALSE )
+                return;
+        #endif
+        // Notify the scheduler task to execute again since an ISR has been activated during context witching to here
+        vTaskNotifyGiveFromISR( xSchedulerEDFHandle, &xHigherPriorityTaskWoken );
+        // Request a context switch to the higher priority task returned by the scheduler
+        portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+    }
+
+    #if( configENABLE_POLICY_SELECT == 1 )
+        /* Fixed priority: the priority given by the user, the highest first */
+        static TickType_t prvGetKeyFixed( cTCB_t *pxTCB ){
+            return ( TickType_t ) ( configMAX_PRIORITIES - pxTCB->xPriority );
+        }
+
+        /* RMS: the period */
+        static TickType_t prvGetKeyRM( cTCB_t *pxTCB ){
+            return pxTCB->xPeriod;
+        }
+
+        /* EDF: the absolute deadline of the next job */
+        static TickType_t prvGetKeyEDF( cTCB_t *pxTCB ){
+            return prvGetDeadlineKey( pxTCB, ullGetTickCount64() );
+        }
+
+        /* Assign the RMS priorities once, from the shortest period (ties keep the creation order) */
+        static void prvSetRM(){
+            cTCB_t *pxTCB;
+            UBaseType_t xHighestPriority = configSCHED_PRIO - 1;
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                // Set the priority from higher to lower since the list is sorted by ascending periods
+                pxTCB->xPriority = xHighestPriority;
+                xHighestPriority--;
+
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        }
+    #endif
+
+    /* Time on the 64-bit time base of a tick count value less than half the tick range away from now */
+    static uint64_t prvExtendTime( TickType_t xTime ){
+        uint64_t ullNow = ullGetTickCount64();
+        TickType_t xAhead = xTime - ( TickType_t ) ullNow;
+
+        if( xAhead <= ( portMAX_DELAY >> 1 ) )
+            return ullNow + xAhead;
+        return ullNow - ( TickType_t ) ( ( TickType_t ) ullNow - xTime );
+    }
+
+    /* Key of a job in the Task List: the time left to its absolute deadline, so the 32-bit list values never wrap
+     * (the list is sorted again from the same instant at every change) */
+    static TickType_t prvGetDeadlineKey( cTCB_t *pxTCB, uint64_t ullNow ){
+        if( pxTCB->ullAbsDeadline <= ullNow )
+            return 0;
+        if( pxTCB->ullAbsDeadline - ullNow >= portMAX_DELAY )
+            return portMAX_DELAY;
+        return ( TickType_t ) ( pxTCB->ullAbsDeadline - ullNow );
+    }
+#endif
+
+
+#if( configENABLE_APERIODIC == 1 )
+    /* Initialize TCB Item and insert it in Aperiodic Task List */
+    static void prvInitialiseTCBAItem( cTCBA_t *pxTCBA ){
+        vListInitialiseItem( &pxTCBA->pxTCBAItem );
+        // The owner of a list item is the object (usually a TCB) that contains the list item
+        listSET_LIST_ITEM_OWNER( &pxTCBA->pxTCBAItem, pxTCBA );
+        // The list is sorted in ascending order by arrival time (FIFO)
+        listSET_LIST_ITEM_VALUE( &pxTCBA->pxTCBAItem, pxTCBA->xArrival);
+
+        // Insert in Aperiodic FIFO queue
+        vListInsert( pxAperiodicTASK_List, &pxTCBA->pxTCBAItem );
+    }
+
+#endif
+
+#if( configENABLE_APERIODIC == 1 && configENABLE_SLACK_STEALING == 0 )
+    /* Execute the first Aperiodic Task of the FIFO queue if it meets the budget, return NULL otherwise */
+    static cTCBA_t *prvPollingServerDispatch( cTCB_t *pxTCB ){
+        // Get the first aperiodic task from the Aperiodic FIFO queue
+        ListItem_t *pxTCBA_Pointer = listGET_HEAD_ENTRY( pxAperiodicTASK_List );
+        cTCBA_t *pxTCBA = listGET_LIST_ITEM_OWNER( pxTCBA_Pointer );
+
+        TickType_t xBudget = pxTCB->xBudgetPS;
+        #if( configENABLE_RECLAIMING == 1 )
+            // The capacities reclaimed from the early completions extend the budget
+            xBudget += prvCapacityAvailable( pxTCB );
+        #endif
+
+        // Check if the WCET of the aperiodic meets the budget of the polling server. If yes, execute it
+        if( pxTCBA->xWCET >= xBudget )
+            return NULL;
+
+        pxTCBA->pxTaskCode( pxTCBA->pvParameters );
+        uxListRemove( pxTCBA_Pointer );
+        return pxTCBA;
+    }
+
+    /* Polling Server Code function that tries to execute Aperiodic Tasks */
+    static void prvPollingServerCode(){
+        cTCBA_t *pxTCBA;
+        TaskHandle_t xTaskCurrentHandle = xTaskGetCurrentTaskHandle();
+
+        // Get pointer to the TCB of the Polling Server
+        #if( configENABLE_RM == 1 )
+            cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS(xTaskCurrentHandle);
+        #elif( configENABLE_EDF == 1 )
+            cTCB_t *pxTCB = prvGetTCBFromListByHandleEDF(xTaskCurrentHandle);
+        #endif
+
+        #if( configENABLE_FIRM_APERIODIC == 1 )
+            // The budget comes back at every job of the server, and the firm jobs guaranteed on it are served first
+            pxTCB->xBudgetPS = configMAX_BUDGET_PS;
+            prvFirmServe( pxTCB );
+        #endif
+        for( ; ; ){
+            if( pxAperiodicTASK_List->uxNumberOfItems == 0 ){
+                printf("[PS] No Aperiodic Tasks to Serve\n");
+                return;
+            }
+
+            pxTCBA = prvPollingServerDispatch( pxTCB );
+            if( pxTCBA != NULL ){
+                printf("\n[PS] Aperiodic Task %s executed - Polling Server Budget = %lu\n",
+                       pxTCBA->pcName, pxTCB->xBudgetPS);
+                #if( configENABLE_RECLAIMING == 1 )
+                    printf("[PS] Reclaimed capacity %lu - Used %lu\n", xReclaimed, xReclaimedUsed);
+                #endif
+                vPortFree( pxTCBA );
+            }
+            else    //Reset budget of Polling Server
+            {
+                pxTCBA = listGET_OWNER_OF_HEAD_ENTRY( pxAperiodicTASK_List );
+                pxTCB->xBudgetPS = configMAX_BUDGET_PS;
+                printf("[PS] Next Aperiodic Task %s not schedulable - Reset Polling Server Budget to %lu\n",
+                       pxTCBA->pcName, pxTCB->xBudgetPS);
+                return;
+            }
+        }
+    }
+
+    /* Create Polling Server (periodic) Task */
+    static void prvPollingServerInit(){
+        vPeriodicTaskCreate(prvPollingServerCode, "PS", &xPSHandle, configMINIMAL_STACK_SIZE, NULL,
+                            8,pdMS_TO_TICKS(0),pdMS_TO_TICKS(900), pdMS_TO_TICKS(800), configMAX_BUDGET_PS);
+        #if( configENABLE_DUAL_PRIORITY == 1 )
+            // The aperiodic tasks run ahead of the hard jobs not promoted yet
+            vPeriodicTaskSetSoft( &xPSHandle );
+        #endif
+    }
+#endif
+
+#if( configENABLE_FIRM_APERIODIC == 1 )
+    /* Move the job in the slot given towards the root of the heap until its parent has an earlier deadline */
+    static void prvFirmSiftUp( cTCBA_t **ppxHeap, UBaseType_t uxSlot ){
+        cTCBA_t *pxTCBA = ppxHeap[ uxSlot ];
+        while( uxSlot > 0 && ppxHeap[ ( uxSlot - 1 ) / 2 ]->ullAbsDeadline > pxTCBA->ullAbsDeadline ){
+            ppxHeap[ uxSlot ] = ppxHeap[ ( uxSlot - 1 ) / 2 ];
+            uxSlot = ( uxSlot - 1 ) / 2;
+        }
+        ppxHeap[ uxSlot ] = pxTCBA;
+    }
+
+    /* Move the job in the slot given towards the leaves of the heap until its children have later deadlines */
+    static void prvFirmSiftDown( cTCBA_t **ppxHeap, UBaseType_t uxCount, UBaseType_t uxSlot ){
+        cTCBA_t *pxTCBA = ppxHeap[ uxSlot ];
+        UBaseType_t uxChild;
+        while( ( uxChild = 2 * uxSlot + 1 ) < uxCount ){
+            if( uxChild + 1 < uxCount && ppxHeap[ uxChild + 1 ]->ullAbsDeadline < ppxHeap[ uxChild ]->ullAbsDeadline )
+                uxChild++;
+            if( ppxHeap[ uxChild ]->ullAbsDeadline >= pxTCBA->ullAbsDeadline )
+                break;
+            ppxHeap[ uxSlot ] = ppxHeap[ uxChild ];
+            uxSlot = uxChild;
+        }
+        ppxHeap[ uxSlot ] = pxTCBA;
+    }
+
+    /* Remove the job with the earliest deadline from a heap (NULL if empty) */
+    static cTCBA_t *prvFirmPop( cTCBA_t **ppxHeap, UBaseType_t *puxCount ){
+        cTCBA_t *pxTCBA;
+        if( *puxCount == 0 )
+            return NULL;
+
+        pxTCBA = ppxHeap[ 0 ];
+        ( *puxCount )--;
+        if( *puxCount > 0 ){
+            ppxHeap[ 0 ] = ppxHeap[ *puxCount ];
+            prvFirmSiftDown( ppxHeap, *puxCount, 0 );
+        }
+        return pxTCBA;
+    }
+
+    /* Acceptance test of a firm job: the jobs queued and the new one are packed by deadline into the next jobs of the
+     * Polling Server, as its dispatch does (a job is served only if its WCET is below the budget left), and each must
+     * complete by its deadline. A server job released at r completes by r + R (the WCRT under RMS, the deadline under
+     * EDF); the job of the server already released is not counted on */
+    static BaseType_t prvFirmAcceptanceTest( cTCBA_t *pxNew ){
+        cTCB_t *pxServer = prvGetTCBFromListByTaskHandle( &xPSHandle );
+        TickType_t xNow = xTaskGetTickCount();
+        uint64_t ullRelease = ullGetTickCount64();
+        TickType_t xSince, xResponse, xBudget;
+        UBaseType_t uxCount;
+        cTCBA_t *pxTCBA;
+
+        // The server is created at the start, and a job longer than its budget is never served
+        if( xPSHandle == NULL || pxServer == NULL || uxFirmJobs == configMAX_FIRM_APERIODIC ||
+            pxNew->xWCET >= configMAX_BUDGET_PS )
+            return pdFALSE;
+
+        #if( configENABLE_RM == 1 )
+            xResponse = pxServer->xWCRT;
+        #else
+            xResponse = pxServer->xDeadline;
+        #endif
+        // Next release of the server after now
+        xSince = xNow - pxServer->xLastWakeTime;
+        if( xSince > ( portMAX_DELAY >> 1 ) )
+            ullRelease += pxServer->xLastWakeTime - xNow;
+        else ullRelease += pxServer->xPeriod - xSince % pxServer->xPeriod;
+
+        // The queue is sorted on a copy, popping the jobs by deadline
+        memcpy( pxFirmScratch, pxFirmJobs, uxFirmJobs * sizeof( cTCBA_t * ) );
+        pxFirmScratch[ uxFirmJobs ] = pxNew;
+        prvFirmSiftUp( pxFirmScratch, uxFirmJobs );
+        uxCount = uxFirmJobs + 1;
+
+        xBudget = configMAX_BUDGET_PS;
+        while( ( pxTCBA = prvFirmPop( pxFirmScratch, &uxCount ) ) != NULL ){
+            if( pxTCBA->xWCET >= xBudget ){
+                ullRelease += pxServer->xPeriod;
+                xBudget = configMAX_BUDGET_PS;
+            }
+            xBudget -= pxTCBA->xWCET;
+            if( ullRelease + xResponse > pxTCBA->ullAbsDeadline )
+                return pdFALSE;
+        }
+        return pdTRUE;
+    }
+
+    /* Serve the firm jobs by deadline while the WCET of the earliest one is below the budget left */
+    static void prvFirmServe( cTCB_t *pxServer ){
+        cTCBA_t *pxTCBA;
+
+        for( ; ; ){
+            taskENTER_CRITICAL();
+            if( uxFirmJobs == 0 || pxFirmJobs[ 0 ]->xWCET >= pxServer->xBudgetPS ){
+                taskEXIT_CRITICAL();
+                return;
+            }
+            pxTCBA = prvFirmPop( pxFirmJobs, &uxFirmJobs );
+            taskEXIT_CRITICAL();
+
+            pxTCBA->pxTaskCode( pxTCBA->pvParameters );
+            printf("\n[PS] Firm Aperiodic Task %s %s - Deadline %lu - Tick count %lu - Polling Server Budget = %lu\n",
+                   pxTCBA->pcName, ( ullGetTickCount64() <= pxTCBA->ullAbsDeadline ) ? "executed" : "late",
+                   ( TickType_t ) pxTCBA->ullAbsDeadline, xTaskGetTickCount(), pxServer->xBudgetPS);
+            vPortFree( pxTCBA );
+        }
+    }
+#endif
+
+#if( configENABLE_RECLAIMING == 1 )
+    /* Drop the capacities whose deadline has been reached (the earliest ones, since they are sorted by deadline) */
+    static void prvCapacityExpire( TickType_t xNow ){
+        UBaseType_t uxExpired = 0;
+        UBaseType_t i;
+
+        while( uxExpired < uxCapacities && ( TickType_t ) ( xNow - xCapacities[ uxExpired ].xDeadline ) <= ( portMAX_DELAY >> 1 ) )
+            uxExpired++;
+        if( uxExpired == 0 )
+            return;
+        for( i = uxExpired; i < uxCapacities; i++ )
+            xCapacities[ i - uxExpired ] = xCapacities[ i ];
+        uxCapacities -= uxExpired;
+    }
+
+    /* Queue the budget left unused by a completed job (CASH). One tick is kept, since the execution time is counted
+     * at the ticks; the capacity is lost if the queue is full or the job is late */
+    static void prvCapacityRelease( cTCB_t *pxTask ){
+        TickType_t xNow = xTaskGetTickCount();
+        cCapacity_t xCapacity;
+        UBaseType_t i;
+
+        if( pxTask->xPS == pdTRUE || pxTask->xTimeSpent + 1 >= pxTask->xWCET )
+            return;
+        xCapacity.xCapacity = pxTask->xWCET - pxTask->xTimeSpent - 1;
+        xCapacity.xDeadline = pxTask->xLastWakeTime + pxTask->xDeadline;
+        xCapacity.xPriority = pxTask->xPriority;
+
+        taskENTER_CRITICAL();
+        prvCapacityExpire( xNow );
+        if( uxCapacities < configMAX_CAPACITIES && ( TickType_t ) ( xNow - xCapacity.xDeadline ) > ( portMAX_DELAY >> 1 ) ){
+            // Sorted by the time left to the deadline, so the wrap of the tick count does not matter
+            for( i = uxCapacities; i > 0 && xCapacities[ i - 1 ].xDeadline - xNow > xCapacity.xDeadline - xNow; i-- )
+                xCapacities[ i ] = xCapacities[ i - 1 ];
+            xCapacities[ i ] = xCapacity;
+            uxCapacities++;
+            xReclaimed += xCapacity.xCapacity;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    /* A capacity is used by the Polling Server without delaying the jobs it was accounted against: under EDF if its
+     * deadline is not later than the one of the server job, under fixed priorities if its job is not below the server */
+    static BaseType_t prvCapacityEligible( cCapacity_t *pxCapacity, cTCB_t *pxServer, TickType_t xNow ){
+        TickType_t xServerDeadline = pxServer->xLastWakeTime + pxServer->xDeadline;
+
+        #if( configENABLE_EDF == 1 )
+            #if( configENABLE_POLICY_SELECT == 1 )
+                if( pxPolicy->xDynamic == pdFALSE )
+                    return pxCapacity->xPriority >= pxServer->xPriority;
+            #endif
+            // A late server job already runs ahead of every capacity
+            if( ( TickType_t ) ( xNow - xServerDeadline ) <= ( portMAX_DELAY >> 1 ) )
+                return pdFALSE;
+            return pxCapacity->xDeadline - xNow <= xServerDeadline - xNow;
+        #else
+            ( void ) xServerDeadline;
+            ( void ) xNow;
+            return pxCapacity->xPriority >= pxServer->xPriority;
+        #endif
+    }
+
+    /* Reclaimed capacity the Polling Server can use from now: the capacities are consumed in deadline order, so each
+     * one can only be used up to its deadline */
+    static TickType_t prvCapacityAvailable( cTCB_t *pxServer ){
+        TickType_t xNow = xTaskGetTickCount();
+        TickType_t xAvailable = 0;
+        UBaseType_t i;
+
+        taskENTER_CRITICAL();
+        prvCapacityExpire( xNow );
+        for( i = 0; i < uxCapacities; i++ ){
+            if( prvCapacityEligible( &xCapacities[ i ], pxServer, xNow ) == pdFALSE )
+                continue;
+            if( xAvailable + xCapacities[ i ].xCapacity <= xCapacities[ i ].xDeadline - xNow )
+                xAvailable += xCapacities[ i ].xCapacity;
+            else if( xAvailable < xCapacities[ i ].xDeadline - xNow )
+                xAvailable = xCapacities[ i ].xDeadline - xNow;
+        }
+        taskEXIT_CRITICAL();
+        return xAvailable;
+    }
+
+    /* Charge a tick of the Polling Server to the earliest eligible capacity (TickHook): pdFALSE if there is none */
+    static BaseType_t prvCapacityConsume( cTCB_t *pxServer ){
+        TickType_t xNow = xTaskGetTickCountFromISR();
+        UBaseType_t i;
+
+        prvCapacityExpire( xNow );
+        for( i = 0; i < uxCapacities; i++ ){
+            if( prvCapacityEligible( &xCapacities[ i ], pxServer, xNow ) == pdFALSE )
+                continue;
+            xReclaimedUsed++;
+            if( --xCapacities[ i ].xCapacity == 0 ){
+                for( ; i + 1 < uxCapacities; i++ )
+                    xCapacities[ i ] = xCapacities[ i + 1 ];
+                uxCapacities--;
+            }
+            return pdTRUE;
+        }
+        return pdFALSE;
+    }
+
+    /* Charge a tick of the Polling Server (TickHook): once its budget is over and no eligible capacity is left, the
+     * aperiodic task running can not go on without delaying the periodic jobs, so the Budget Task suspends the server */
+    static void prvServerCharge( cTCB_t *pxServer ){
+        TickType_t xNow = xTaskGetTickCountFromISR();
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t i;
+
+        if( prvCapacityConsume( pxServer ) == pdTRUE )
+            return;
+        if( pxServer->xBudgetPS > 0 )
+            pxServer->xBudgetPS--;
+        if( pxServer->xBudgetPS > 0 || pxExhaustedServer != NULL )
+            return;
+        for( i = 0; i < uxCapacities; i++ )
+            if( prvCapacityEligible( &xCapacities[ i ], pxServer, xNow ) == pdTRUE )
+                return;
+
+        pxExhaustedServer = pxServer;
+        vTaskNotifyGiveFromISR( xBudgetHandle, &xHigherPriorityTaskWoken );
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    }
+
+    /* Budget Task code: the exhausted Polling Server is suspended until its next release, where the budget is
+     * replenished */
+    static void prvBudgetCode(){
+        cTCB_t *pxServer;
+        TickType_t xRelease;
+        TickType_t xNow;
+
+        for( ; ; ){
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+            pxServer = pxExhaustedServer;
+            if( pxServer == NULL )
+                continue;
+
+            vTaskSuspend( *pxServer->pxTaskHandle );
+            xNow = xTaskGetTickCount();
+            // The job of the server may already be past its next release: the budget comes back at the first one ahead
+            xRelease = pxServer->xLastWakeTime + pxServer->xPeriod;
+            while( ( TickType_t ) ( xNow - xRelease ) <= ( portMAX_DELAY >> 1 ) )
+                xRelease += pxServer->xPeriod;
+            printf( "\n[PS] Tick count %lu - Budget and capacities exhausted - Suspended until %lu\n", xNow, xRelease );
+            vTaskDelay( xRelease - xNow );
+
+            pxServer->xBudgetPS = configMAX_BUDGET_PS;
+            pxExhaustedServer = NULL;
+            printf( "\n[PS] Tick count %lu - Budget replenished to %lu\n", xTaskGetTickCount(), pxServer->xBudgetPS );
+            vTaskResume( *pxServer->pxTaskHandle );
+        }
+    }
+#endif
+
+#if( configENABLE_SLACK_STEALING == 1 )
+    /* Work of the levels down to pxLevel that must be executed in [xNow, xEnd): remaining WCET of the pending
+     * jobs plus the WCET of every job released before xEnd */
+    static TickType_t prvGetLevelDemand( ListItem_t *pxLevel, TickType_t xNow, TickType_t xEnd ){
+        cTCB_t *pxTCB;
+        TickType_t xDemand = 0;
+        TickType_t xNext;
+        TickType_t xWindow = xEnd - xNow;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+
+        // The times are compared as offsets from xNow, across the tick wraparound
+        for( ; ; ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            xNext = pxTCB->xJobRelease;
+            // Released job not completed yet
+            if( ( TickType_t ) ( xNow - xNext ) <= ( portMAX_DELAY >> 1 ) ){
+                if( pxTCB->xTimeSpent < pxTCB->xWCET )
+                    xDemand += pxTCB->xWCET - pxTCB->xTimeSpent;
+                xNext += pxTCB->xPeriod;
+            }
+            if( ( TickType_t ) ( xNext - xNow ) < xWindow )
+                xDemand += CEIL( xWindow - ( TickType_t ) ( xNext - xNow ), pxTCB->xPeriod ) * pxTCB->xWCET;
+            if( pxTCB_Pointer == pxLevel )
+                break;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return xDemand;
+    }
+
+    /* Slack of the level pxLevel: the longest top priority execution that still lets its job complete
+     * by its deadline, checked as in the WCRT test at the deadline and at the higher priority releases */
+    static TickType_t prvGetLevelSlack( ListItem_t *pxLevel, TickType_t xNow ){
+        cTCB_t *pxTCB;
+        cTCB_t *pxLevelTCB = listGET_LIST_ITEM_OWNER( pxLevel );
+        TickType_t xDeadline = pxLevelTCB->xJobRelease + pxLevelTCB->xDeadline;
+        TickType_t xSlack = 0;
+        TickType_t xEnd;
+        TickType_t xDemand;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+
+        if( ( TickType_t ) ( xNow - xDeadline ) <= ( portMAX_DELAY >> 1 ) )
+            return 0;
+
+        // The times are compared as offsets from xNow, across the tick wraparound
+        for( ; ; ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            // End of the window: next release of a higher priority task or deadline of the level
+            xEnd = pxTCB->xJobRelease;
+            if( ( TickType_t ) ( xNow - xEnd ) <= ( portMAX_DELAY >> 1 ) )
+                xEnd += pxTCB->xPeriod;
+            if( pxTCB_Pointer == pxLevel )
+                xEnd = xDeadline;
+
+            // The job of the level must be released inside the window
+            if( xEnd != xNow && ( TickType_t ) ( xEnd - xNow ) <= ( TickType_t ) ( xDeadline - xNow ) &&
+                xEnd != pxLevelTCB->xJobRelease &&
+                ( TickType_t ) ( xEnd - pxLevelTCB->xJobRelease ) <= ( portMAX_DELAY >> 1 ) ){
+                xDemand = prvGetLevelDemand( pxLevel, xNow, xEnd );
+                if( xDemand + xSlack < xEnd - xNow )
+                    xSlack = xEnd - xNow - xDemand;
+            }
+            if( pxTCB_Pointer == pxLevel )
+                break;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return xSlack;
+    }
+
+    /* Slack available at the top priority: the minimum of the slack of every level */
+    static TickType_t prvGetAvailableSlack(){
+        TickType_t xNow = xTaskGetTickCount();
+        TickType_t xSlack = portMAX_DELAY;
+        TickType_t xLevelSlack;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            xLevelSlack = prvGetLevelSlack( pxTCB_Pointer, xNow );
+            if( xLevelSlack < xSlack )
+                xSlack = xLevelSlack;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return xSlack;
+    }
+
+    /* Slack Stealer Code function that executes Aperiodic Tasks at the top priority while slack is available */
+    static void prvSlackStealerCode(){
+        cTCBA_t *pxTCBA;
+        TickType_t xSlack;
+        TickType_t xStartTick;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            printf("[SS] Task %s - Slack %lu\n", ( ( cTCB_t * ) listGET_LIST_ITEM_OWNER( pxTCB_Pointer ) )->pcName,
+                   prvGetLevelSlack( pxTCB_Pointer, xTaskGetTickCount() ) );
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+
+        for( ; ; ){
+            while( listLIST_IS_EMPTY( pxAperiodicTASK_List ) == pdFALSE ){
+                pxTCBA = listGET_OWNER_OF_HEAD_ENTRY( pxAperiodicTASK_List );
+                xSlack = prvGetAvailableSlack();
+
+                // Not enough slack: a periodic job could miss its deadline, wait for the next completion
+                if( pxTCBA->xWCET > xSlack )
+                    break;
+
+                uxListRemove( &pxTCBA->pxTCBAItem );
+                xStartTick = xTaskGetTickCount();
+                pxTCBA->pxTaskCode( pxTCBA->pvParameters );
+                printf("\n[SS] Aperiodic Task %s executed - Tick count %lu - Execution time %lu (WCET: %lu) - Slack %lu\n",
+                       pxTCBA->pcName, xStartTick, xTaskGetTickCount() - xStartTick, pxTCBA->xWCET, xSlack);
+                vPortFree( pxTCBA );
+            }
+            // Wait for a new aperiodic task or for a periodic job completion
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        }
+    }
+
+    /* Create Slack Stealer Task above every periodic task */
+    static void prvSlackStealerCreate(){
+        xTaskCreate( prvSlackStealerCode,
+                     "SlackStealer",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xSlackStealerHandle);
+    }
+#endif
+/**
+ * ---------------------------------------------------------------------------------
+ */
+
+#if( configENABLE_SRP == 1 )
+    /* Compute the preemption levels, the ceiling of every resource and the blocking term of every task */
+    static void prvSetResourceCeilings(){
+        cTCB_t *pxTCB;
+        cTCB_t *pxOther;
+        UBaseType_t uxResource;
+        ListItem_t *pxOther_Pointer;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( uxResource = 0; uxResource < configMAX_RESOURCES; uxResource++ )
+            xResources[ uxResource ].xCeiling = -1;
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            #if( configENABLE_EDF == 1 )
+                // EDF: the shorter the relative deadline, the higher the level
+                pxTCB->xPreemptionLevel = 0;
+                for( pxOther_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxOther_Pointer != pxTCB_Tail;
+                     pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                    pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                    if( pxOther->xDeadline > pxTCB->xDeadline )
+                        pxTCB->xPreemptionLevel++;
+                }
+            #else
+                pxTCB->xPreemptionLevel = pxTCB->xPriority;
+            #endif
+        }
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            for( uxResource = 0; uxResource < configMAX_RESOURCES; uxResource++ )
+                if( pxTCB->xCSLength[ uxResource ] > 0 && pxTCB->xPreemptionLevel > xResources[ uxResource ].xCeiling )
+                    xResources[ uxResource ].xCeiling = pxTCB->xPreemptionLevel;
+        }
+
+        // B_i: longest critical section of a lower level task on a resource whose ceiling reaches the level of the task
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xBlocking = 0;
+            for( pxOther_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxOther_Pointer != pxTCB_Tail;
+                 pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                if( pxOther->xPreemptionLevel >= pxTCB->xPreemptionLevel )
+                    continue;
+                for( uxResource = 0; uxResource < configMAX_RESOURCES; uxResource++ )
+                    if( xResources[ uxResource ].xCeiling >= pxTCB->xPreemptionLevel &&
+                        pxOther->xCSLength[ uxResource ] > pxTCB->xBlocking )
+                        pxTCB->xBlocking = pxOther->xCSLength[ uxResource ];
+            }
+            printf("Task %s - Preemption level %ld - Blocking %lu\n", pxTCB->pcName, pxTCB->xPreemptionLevel,
+                   pxTCB->xBlocking);
+        }
+    }
+
+    #if( configENABLE_EDF == 1 )
+        /* SRP under EDF: the jobs not started yet whose level does not exceed the system ceiling are moved
+         * below all the others (keeping the deadline order), so they can not preempt the holder */
+        static void prvApplySystemCeilingEDF(){
+            cTCB_t *pxTCB;
+            BaseType_t xHighestPriority = configSCHED_PRIO - 1;
+            BaseType_t xBlocked;
+            ListItem_t *pxTCB_Pointer;
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            for( xBlocked = pdFALSE; xBlocked <= pdTRUE; xBlocked++ ){
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( ( pxTCB->xTaskJobStatus == pdTRUE && pxTCB->xPreemptionLevel <= xSystemCeiling ) != xBlocked )
+                        continue;
+                    pxTCB->xPriority = xHighestPriority;
+                    vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+                    xHighestPriority--;
+                }
+            }
+        }
+
+        #if( configENABLE_FIXED == 0 )
+            /* Baker's test for EDF with SRP: for every task k, the density of the tasks with a deadline not longer
+             * than D_k plus B_k / D_k must not exceed 1 */
+            static BaseType_t prvCheckBlockingBoundEDF( List_t *pxList ){
+                float xU;
+                cTCB_t *pxTCB;
+                cTCB_t *pxOther;
+                ListItem_t *pxOther_Pointer;
+                ListItem_t *pxTCB_Pointer;
+                const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxList ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    xU = (float) pxTCB->xBlocking / pxTCB->xDeadline;
+                    for( pxOther_Pointer = listGET_HEAD_ENTRY( pxList ); pxOther_Pointer != pxTCB_Tail;
+                         pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                        pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                        if( pxOther->xDeadline <= pxTCB->xDeadline )
+                            xU += (float) pxOther->xWCET / pxOther->xDeadline;
+                    }
+                    if( xU > 1.0 )
+                        return pdFALSE;
+                }
+                return pdTRUE;
+            }
+        #endif
+    #endif
+#endif
+
+#if( configENABLE_OVERHEADS == 1 )
+    /* Ticks stolen by the tick interrupts in a window of xWindow ticks */
+    static TickType_t prvGetTickInterference( TickType_t xWindow ){
+        uint32_t ulCycles = xWindow * ulOverheadTick;
+        return CEIL( ulCycles, ulCyclesPerTick );
+    }
+
+    /* Measure the overheads on the running kernel and inflate the WCET of every task with the cost of its job */
+    static void prvCalibrateOverheads(){
+        uint32_t ulStart;
+        uint32_t ulNow;
+        uint32_t ulGap;
+        uint32_t ulMinGap = 0xFFFFFFFFUL;
+        uint32_t ulMaxGap = 0;
+        uint32_t ulJob;
+        TickType_t xEnd;
+        UBaseType_t uxRun;
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        ulCyclesPerTick = benchSYSTICK_LOAD_REG + 1;
+
+        // Tick interrupt: the longest gap between two readings of the cycle counter, minus the shortest one
+        vTaskDelay( 1 );
+        xEnd = xTaskGetTickCount() + configOVH_CALIB_TICKS;
+        ulStart = prvGetCycleCount();
+        while( ( TickType_t ) ( xTaskGetTickCount() - xEnd ) > ( portMAX_DELAY >> 1 ) ){
+            ulNow = prvGetCycleCount();
+            ulGap = ulNow - ulStart;
+            // A gap longer than a tick is not caused by the tick interrupt alone
+            if( ulGap < ulCyclesPerTick ){
+                if( ulGap < ulMinGap )
+                    ulMinGap = ulGap;
+                if( ulGap > ulMaxGap )
+                    ulMaxGap = ulGap;
+            }
+            ulStart = ulNow;
+        }
+        ulOverheadTick = ulMaxGap - ulMinGap;
+
+        // Context switch: a higher priority task preempts the Calibration Task and blocks again at once
+        xTaskCreate( prvCalibrationSwitchCode,
+                     "CalibSwitch",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xCalibrationSwitchHandle);
+        for( uxRun = 0; uxRun < configOVH_CALIB_RUNS; uxRun++ ){
+            vTaskDelay( 1 );
+            ulStart = prvGetCycleCount();
+            xTaskNotifyGive( xCalibrationSwitchHandle );
+            ulGap = prvGetCycleCount() - ulStart;
+            if( ulGap > ulOverheadSwitch )
+                ulOverheadSwitch = ulGap;
+        }
+        vTaskDelete( xCalibrationSwitchHandle );
+
+        #if( configENABLE_EDF == 1 )
+            // EDF scheduler task: re-sort of the whole Task List, done at the release and at the completion of a job
+            for( uxRun = 0; uxRun < configOVH_CALIB_RUNS; uxRun++ ){
+                vTaskDelay( 1 );
+                ulStart = prvGetCycleCount();
+                prvNotifySchedulerEDF();
+                ulGap = prvGetCycleCount() - ulStart;
+                if( ulGap > ulOverheadScheduler )
+                    ulOverheadScheduler = ulGap;
+            }
+        #endif
+
+        printf( "\n[OVERHEADS] Tick %lu cycles - Context switch %lu cycles - Scheduler %lu cycles - %lu cycles per tick\n",
+                ulOverheadTick, ulOverheadSwitch, ulOverheadScheduler, ulCyclesPerTick );
+
+        // Every job preempts (and is preempted) once and activates the EDF scheduler twice
+        ulJob = ulOverheadSwitch + 2 * ulOverheadScheduler;
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xWCET += CEIL( ulJob, ulCyclesPerTick );
+            #if( configENABLE_MIXED_CRITICALITY == 1 )
+                pxTCB->xWCETHigh += CEIL( ulJob, ulCyclesPerTick );
+            #endif
+        }
+    }
+
+    /* Task preempting the Calibration Task: blocks again as soon as it is notified */
+    static void prvCalibrationSwitchCode(){
+        for( ; ; )
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+    }
+
+    /* Calibration Task code: measure the overheads, check the feasibility and release the periodic tasks */
+    static void prvCalibrationCode(){
+        cTCB_t *pxTCB;
+        TickType_t xNow;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        prvCalibrateOverheads();
+        if( prvCheckFeasibility() == pdFALSE )
+            vTaskDelete( NULL );
+
+        // The first releases are moved after the calibration
+        vTaskSuspendAll();
+        xNow = xTaskGetTickCount();
+        xStartTime = xNow;
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xLastWakeTime += xNow;
+            #if( configENABLE_SLACK_STEALING == 1 )
+                pxTCB->xJobRelease += xNow;
+            #endif
+            #if( configENABLE_EDF == 1 )
+                pxTCB->ullAbsDeadline += xNow;
+            #endif
+            vTaskResume( *pxTCB->pxTaskHandle );
+        }
+        xTaskResumeAll();
+        #if( configENABLE_EDF == 1 )
+            prvNotifySchedulerEDF();
+        #endif
+        vTaskDelete( NULL );
+    }
+
+    /* Keep the periodic tasks suspended and create the Calibration Task (below the scheduler tasks) */
+    static void prvCalibrationCreate(){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            vTaskSuspend( *pxTCB->pxTaskHandle );
+        }
+        xTaskCreate( prvCalibrationCode,
+                     "Calibration",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO - 1,
+                     NULL);
+    }
+#endif
+
+#if( configENABLE_MIXED_CRITICALITY == 1 )
+    /* Feasibility Test for mixed criticality with AMC-rtb: the WCRT test with the LO WCETs, then the HI tasks
+     * across the mode switch (each WCRT is printed if verbose) */
+    static BaseType_t prvCheckFeasibilityAMC( List_t *pxList, BaseType_t xVerbose ){
+        cTCB_t *pxTCB;
+        TickType_t xRHI;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxList );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxList );
+
+        // LO mode: every task with its LO WCET
+        if( prvCheckFeasibilityWCRT( pxList, pdFALSE ) == pdFALSE )
+            return pdFALSE;
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->xCriticality == CRITICALITY_HI ){
+                xRHI = prvGetResponseTimeAMC( pxList, pxTCB_Pointer, pxTCB->xWCRT );
+                if( xRHI > pxTCB->xDeadline )
+                    return pdFALSE;
+                if( xVerbose == pdTRUE )
+                    printf("Task %s - HI - WCET %lu/%lu - WCRT %lu/%lu\n", pxTCB->pcName, pxTCB->xWCET,
+                           pxTCB->xWCETHigh, pxTCB->xWCRT, xRHI);
+            }
+            else if( xVerbose == pdTRUE )
+                printf("Task %s - LO - WCET %lu - WCRT %lu\n", pxTCB->pcName, pxTCB->xWCET, pxTCB->xWCRT);
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        return pdTRUE;
+    }
+
+    /* WCRT of a HI task in HI mode: the higher priority LO tasks only interfere up to the LO mode
+     * response time xRLO (stops as soon as the deadline is exceeded) */
+    static TickType_t prvGetResponseTimeAMC( List_t *pxList, ListItem_t *pxItem, TickType_t xRLO ){
+        cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+        cTCB_t *pxHigherPriority;
+        ListItem_t *pxHigherPriority_Pointer;
+        TickType_t xC = pxTCB->xWCETHigh;
+        TickType_t xR = xC;
+        TickType_t xNext;
+
+        #if( configENABLE_SRP == 1 )
+            xC += pxTCB->xBlocking;
+        #endif
+
+        for( ; ; ){
+            xNext = xC;
+            for( pxHigherPriority_Pointer = listGET_HEAD_ENTRY( pxList ); pxHigherPriority_Pointer != pxItem;
+                 pxHigherPriority_Pointer = listGET_NEXT( pxHigherPriority_Pointer ) ){
+                pxHigherPriority = listGET_LIST_ITEM_OWNER( pxHigherPriority_Pointer );
+                if( pxHigherPriority->xCriticality == CRITICALITY_HI )
+                    xNext += CEIL( xR, pxHigherPriority->xPeriod ) * pxHigherPriority->xWCETHigh;
+                else
+                    xNext += CEIL( xRLO, pxHigherPriority->xPeriod ) * pxHigherPriority->xWCET;
+            }
+            #if( configENABLE_OVERHEADS == 1 )
+                xNext += prvGetTickInterference( xR );
+            #endif
+            if( xNext == xR || xNext > pxTCB->xDeadline )
+                return xNext;
+            xR = xNext;
+        }
+    }
+
+    /* Mode Switch Task code: degrade the LO tasks in HI mode, restore them at the first idle instant
+     * without LO jobs left */
+    static void prvModeSwitchCode(){
+        cTCB_t *pxTCB;
+        BaseType_t xMode = CRITICALITY_LO;
+        BaseType_t xPending;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( ; ; ){
+            // One notification at a time: an idle instant given right after the overrun is not lost
+            ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+
+            if( xCriticalityMode == CRITICALITY_HI && xMode == CRITICALITY_LO ){
+                xMode = CRITICALITY_HI;
+                printf( "\n[MODE] Tick count %lu - HI mode - Task %s exceeded its LO WCET %lu\n", xTaskGetTickCount(),
+                        pxOverrunTask->pcName, pxOverrunTask->xWCET );
+                // The started LO jobs can only complete in background
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( pxTCB->xCriticality == CRITICALITY_LO )
+                        vTaskPrioritySet( *pxTCB->pxTaskHandle, tskIDLE_PRIORITY );
+                }
+            }
+            else if( xCriticalityMode == CRITICALITY_HI ){
+                xPending = pdFALSE;
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( pxTCB->xCriticality == CRITICALITY_LO && pxTCB->xTaskJobStatus == pdFALSE )
+                        xPending = pdTRUE;
+                }
+                if( xPending == pdTRUE )
+                    continue;
+
+                xMode = CRITICALITY_LO;
+                xCriticalityMode = CRITICALITY_LO;
+                printf( "\n[MODE] Tick count %lu - LO mode\n", xTaskGetTickCount() );
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( pxTCB->xCriticality == CRITICALITY_LO )
+                        vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+                }
+            }
+        }
+    }
+#endif
+
+#if( configENABLE_MK_FIRM == 1 )
+    /* Mandatory jobs among the first xJobs ones of the evenly distributed (m,k) pattern, the largest number of
+     * mandatory jobs among any xJobs consecutive ones */
+    static TickType_t prvGetMandatoryJobs( cTCB_t *pxTCB, TickType_t xJobs ){
+        TickType_t xMandatory;
+
+        if( pxTCB->uxM == pxTCB->uxK )
+            return xJobs;
+        xMandatory = xJobs * pxTCB->uxM;
+        return CEIL( xMandatory, pxTCB->uxK );
+    }
+
+    /* The job of index j is mandatory in the evenly distributed pattern if j = floor( ceil( j * m / k ) * k / m ),
+     * or if missing it would already violate the (m,k) constraint */
+    static BaseType_t prvIsMandatoryJob( cTCB_t *pxTCB ){
+        UBaseType_t uxJob = pxTCB->uxJobIndex % pxTCB->uxK;
+        UBaseType_t uxPattern = uxJob * pxTCB->uxM;
+
+        uxPattern = CEIL( uxPattern, pxTCB->uxK ) * pxTCB->uxK / pxTCB->uxM;
+        if( uxPattern == uxJob )
+            return pdTRUE;
+        return ( prvGetDistanceToFailure( pxTCB ) <= 1 ) ? pdTRUE : pdFALSE;
+    }
+
+    /* Distance Based Priority: number of consecutive misses from now leading to less than m met jobs in the
+     * last k ones (1 means the current job can not be lost) */
+    static UBaseType_t prvGetDistanceToFailure( cTCB_t *pxTCB ){
+        uint32_t ulMask = ( pxTCB->uxK == 32 ) ? 0xFFFFFFFFUL : ( ( 1UL << pxTCB->uxK ) - 1 );
+        uint32_t ulHistory = pxTCB->ulHistory;
+        UBaseType_t uxDistance = 0;
+
+        do{
+            ulHistory = ( ulHistory << 1 ) & ulMask;
+            uxDistance++;
+        }while( ( UBaseType_t ) __builtin_popcount( ulHistory ) >= pxTCB->uxM );
+        return uxDistance;
+    }
+
+    /* Shift the outcome of the current job into the history and move to the next job of the pattern: a dynamic failure
+     * is reported once less than m of the last k jobs met their deadline */
+    static void prvRecordJobOutcome( cTCB_t *pxTCB, BaseType_t xMet ){
+        uint32_t ulMask = ( pxTCB->uxK == 32 ) ? 0xFFFFFFFFUL : ( ( 1UL << pxTCB->uxK ) - 1 );
+
+        pxTCB->ulHistory = ( ( pxTCB->ulHistory << 1 ) | ( xMet == pdTRUE ) ) & ulMask;
+        pxTCB->uxJobIndex++;
+        if( ( UBaseType_t ) __builtin_popcount( pxTCB->ulHistory ) < pxTCB->uxM )
+            printf( "\n[DYNAMIC FAILURE] Tick count %lu - Task %s\n", xTaskGetTickCount(), pxTCB->pcName );
+    }
+
+    /* Print the guaranteed pattern of every (m,k)-firm task (M mandatory, o optional) */
+    static void prvPrintFirmPatterns(){
+        cTCB_t *pxTCB;
+        UBaseType_t uxJob;
+        UBaseType_t uxIndex;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->uxM < pxTCB->uxK ){
+                printf( "Task %s - (m,k) = (%lu,%lu) - Pattern ", pxTCB->pcName, pxTCB->uxM, pxTCB->uxK );
+                uxIndex = pxTCB->uxJobIndex;
+                for( uxJob = 0; uxJob < pxTCB->uxK; uxJob++ ){
+                    pxTCB->uxJobIndex = uxJob;
+                    printf( "%c", ( prvIsMandatoryJob( pxTCB ) == pdTRUE ) ? 'M' : 'o' );
+                }
+                pxTCB->uxJobIndex = uxIndex;
+                printf( "\n" );
+            }
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
+
+    /* The band of the optional jobs goes from just below the lowest mandatory priority down to just above the Idle Task */
+    static void prvSetOptionalBand(){
+        cTCB_t *pxTCB;
+        UBaseType_t uxLowest = configMAX_PRIORITIES;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( ( UBaseType_t ) pxTCB->xPriority < uxLowest )
+                uxLowest = pxTCB->xPriority;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        uxOptionalPriority = ( uxLowest > tskIDLE_PRIORITY + 1 ) ? uxLowest - 1 : tskIDLE_PRIORITY;
+    }
+
+    /* Distance Based Priority of an optional job: one level of the band per distance to failure, from distance 2 (the
+     * shortest one of an optional job) at the top. The distances beyond the band share its lowest level */
+    static UBaseType_t prvGetOptionalPriority( cTCB_t *pxTCB ){
+        UBaseType_t uxLevel = prvGetDistanceToFailure( pxTCB ) - 2;
+
+        if( uxOptionalPriority == tskIDLE_PRIORITY )
+            return tskIDLE_PRIORITY;
+        if( uxLevel > uxOptionalPriority - ( tskIDLE_PRIORITY + 1 ) )
+            return tskIDLE_PRIORITY + 1;
+        return uxOptionalPriority - uxLevel;
+    }
+
+    /* Called by the TickHook: an optional job still running at its deadline is asked to give up, and handed to the
+     * Abort Task if it is still running configMK_ABORT_GRACE ticks later */
+    static void prvOptionalJobsTick( TickType_t xTick ){
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->xOptional == pdTRUE && xTick - pxTCB->xLastWakeTime >= pxTCB->xDeadline ){
+                pxTCB->xOptional = pdFALSE;
+                pxTCB->xAborted = pdTRUE;
+            }else if( pxTCB->xAborted == pdTRUE && pxTCB->xTaskJobStatus == pdFALSE &&
+                      xTick - pxTCB->xLastWakeTime >= pxTCB->xDeadline + configMK_ABORT_GRACE )
+                vTaskNotifyGiveFromISR( xAbortHandle, &xHigherPriorityTaskWoken );
+        }
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    }
+
+    /* Abort Task code: a job can not be stopped from outside, so the task running a late optional job that did not
+     * give up is deleted and created again, waiting for its next release. The job counts as missed */
+    static void prvAbortCode(){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( ; ; ){
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+            for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                 pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                // A job that gave up meanwhile has already been completed by its task
+                if( pxTCB->xAborted == pdFALSE || pxTCB->xTaskJobStatus == pdTRUE )
+                    continue;
+
+                vTaskDelete( *pxTCB->pxTaskHandle );
+                printf( "\n[ABORTED] Tick count %lu - Task %s - LastWakeTime %lu - Distance %lu\n", xTaskGetTickCount(),
+                        pxTCB->pcName, pxTCB->xLastWakeTime, prvGetDistanceToFailure( pxTCB ) );
+                prvRecordJobOutcome( pxTCB, pdFALSE );
+                prvJobExit( pxTCB );
+                // The memory of the deleted task is only freed by the Idle Task
+                if( xTaskCreate( prvPeriodicTaskMaster,
+                                 pxTCB->pcName,
+                                 pxTCB->ulStackDepth,
+                                 pxTCB->pvParameters,
+                                 pxTCB->xPriority,
+                                 pxTCB->pxTaskHandle) != pdPASS )
+                    printf( "\n[ABORTED] Tick count %lu - Task %s - Restart failed (out of memory) - Task lost\n",
+                            xTaskGetTickCount(), pxTCB->pcName );
+            }
+        }
+    }
+#endif
+
+#if( configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 )
+    /* Wait for the next arrival of a sporadic task: its job is released at least one period (minimum inter-arrival
+     * time) after the previous one */
+    static void prvSporadicWaitRelease( cTCB_t *pxTask, BaseType_t xFirst ){
+        TickType_t xArrival;
+
+        xQueueReceive( pxTask->xArrivalQueue, &xArrival, portMAX_DELAY );
+        if( xFirst == pdFALSE && xArrival - pxTask->xLastWakeTime < pxTask->xPeriod ){
+            // Early arrival: the job is deferred (no wait if the previous job completed late)
+            printf( "\n[DEFERRED] Tick count %lu - Task %s - Arrival %lu - Release %lu\n", xTaskGetTickCount(), pxTask->pcName,
+                    xArrival, pxTask->xLastWakeTime + pxTask->xPeriod );
+            vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+        }else
+            pxTask->xLastWakeTime = xArrival;
+
+        #if( configENABLE_EDF == 1 )
+            // The deadline set at the completion of the previous job assumed the earliest release
+            pxTask->ullAbsDeadline = prvExtendTime( pxTask->xLastWakeTime ) + pxTask->xDeadline;
+            // The priorities follow the new deadline
+            prvNotifySchedulerEDF();
+        #endif
+    }
+#endif
+
+#if( configENABLE_SPORADIC == 1 )
+    /* Return the TCB of a sporadic task by the pointer to the Task Handle given at creation (safe from the ISRs) */
+    static cTCB_t *prvGetSporadicTCB( TaskHandle_t *pxTaskHandle ){
+        UBaseType_t uxTask;
+        for( uxTask = 0; uxTask < uxSporadicTasks; uxTask++ )
+            if( pxSporadicTCBs[ uxTask ]->pxTaskHandle == pxTaskHandle )
+                return pxSporadicTCBs[ uxTask ];
+        return NULL;
+    }
+#endif
+
+#if( configENABLE_CHAINS == 1 )
+    /* Longest time between two releases of a task: the triggered tasks inherit the response times of their triggers */
+    static TickType_t prvChainGetMaxInterArrival( cTCB_t *pxTCB ){
+        TickType_t xJitter = 0;
+        while( pxTCB->pxTrigger != NULL ){
+            xJitter += pxTCB->pxTrigger->xWCRT;
+            pxTCB = pxTCB->pxTrigger;
+        }
+        return pxTCB->xPeriod + xJitter;
+    }
+
+    /* Worst-case end-to-end latency (from an input to the first output reflecting it) and data age (from the release
+     * sampling an input to the last output based on it) of every chain, from the WCRTs of its stages (Davare) */
+    static BaseType_t prvCheckChains(){
+        BaseType_t xFeasible = pdTRUE;
+        cChain_t *pxChain;
+        cTCB_t *pxStage;
+        cTCB_t *pxProducer;
+        TickType_t xLatency;
+        TickType_t xAge;
+        UBaseType_t uxChain;
+        UBaseType_t uxStage;
+
+        for( uxChain = 0; uxChain < configMAX_CHAINS; uxChain++ ){
+            pxChain = &xChains[ uxChain ];
+            if( pxChain->uxLength == 0 )
+                continue;
+
+            printf( "\nChain %s\n", pxChain->pcName );
+            // The input is sampled by the head at its releases, or releases a sporadic head
+            xLatency = prvChainGetMaxInterArrival( pxChain->pxStages[ 0 ] );
+            if( pxChain->pxStages[ 0 ]->xArrivalQueue != NULL && pxChain->pxStages[ 0 ]->pxTrigger == NULL )
+                xLatency = 0;
+            xAge = 0;
+            for( uxStage = 0; uxStage < pxChain->uxLength; uxStage++ ){
+                pxStage = pxChain->pxStages[ uxStage ];
+                if( uxStage > 0 ){
+                    pxProducer = pxChain->pxStages[ uxStage - 1 ];
+                    if( pxStage->pxTrigger == pxProducer ){
+                        // Released by the completed job of the producer: every output is read once
+                        xLatency += pxProducer->xWCRT;
+                        xAge += pxProducer->xWCRT;
+                    }else if( pxStage->pxTrigger == NULL && pxProducer->pxTrigger == NULL &&
+                              pxStage->xPeriod == pxProducer->xPeriod && pxStage->xPriority < pxProducer->xPriority &&
+                              pxStage->xArrivalTime % pxStage->xPeriod == pxProducer->xArrivalTime % pxProducer->xPeriod ){
+                        // Released together with a higher priority producer: the job starts once the producer has written
+                    }else{
+                        // Sampling: the output is read at the next release of the stage and overwritten by the next
+                        // completed job of the producer
+                        xLatency += pxProducer->xWCRT + prvChainGetMaxInterArrival( pxStage );
+                        xAge += pxProducer->xWCRT + prvChainGetMaxInterArrival( pxProducer );
+                    }
+                }
+                printf( "    Task %s - Period %lu - Offset %lu - Priority %ld - WCRT %lu", pxStage->pcName, pxStage->xPeriod,
+                        pxStage->xArrivalTime, pxStage->xPriority, pxStage->xWCRT );
+                if( pxStage->pxTrigger != NULL )
+                    printf( " - Triggered by %s", pxStage->pxTrigger->pcName );
+                printf( "\n" );
+            }
+            // The output is written by the tail
+            xLatency += pxChain->pxStages[ pxChain->uxLength - 1 ]->xWCRT;
+            xAge += pxChain->pxStages[ pxChain->uxLength - 1 ]->xWCRT;
+
+            printf( "Chain %s - Latency %lu - Data age %lu - Deadline %lu\n", pxChain->pcName, xLatency, xAge,
+                    pxChain->xDeadline );
+            if( pxChain->xDeadline != 0 && xLatency > pxChain->xDeadline )
+                xFeasible = pdFALSE;
+        }
+        return xFeasible;
+    }
+
+    #if( configCHAIN_TUNING == 1 )
+        /* Longest path of every task from a chain head, following the chains and the triggers */
+        static void prvChainAssignDepths(){
+            cTCB_t *pxTCB;
+            cTCB_t *pxProducer;
+            UBaseType_t uxChain;
+            UBaseType_t uxStage;
+            UBaseType_t uxPass;
+            ListItem_t *pxTCB_Pointer;
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            // A path is at most configMAX_CHAINS * configMAX_CHAIN_LENGTH links long (the passes bound even a cycle)
+            for( uxPass = 0; uxPass < configMAX_CHAINS * configMAX_CHAIN_LENGTH; uxPass++ ){
+                for( uxChain = 0; uxChain < configMAX_CHAINS; uxChain++ ){
+                    for( uxStage = 1; uxStage < xChains[ uxChain ].uxLength; uxStage++ ){
+                        pxTCB = xChains[ uxChain ].pxStages[ uxStage ];
+                        pxProducer = xChains[ uxChain ].pxStages[ uxStage - 1 ];
+                        if( pxTCB->uxChainDepth <= pxProducer->uxChainDepth )
+                            pxTCB->uxChainDepth = pxProducer->uxChainDepth + 1;
+                    }
+                }
+                for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                     pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( pxTCB->pxTrigger != NULL && pxTCB->uxChainDepth <= pxTCB->pxTrigger->uxChainDepth )
+                        pxTCB->uxChainDepth = pxTCB->pxTrigger->uxChainDepth + 1;
+                }
+            }
+        }
+
+        /* Shorten the chains before the RMS priorities are assigned: among equal periods the producers get the higher
+         * priority, and the time-triggered stages are released together with their producer of equal period */
+        static void prvChainTune(){
+            List_t xUnsorted;
+            cTCB_t *pxTCB;
+            cTCB_t *pxProducer;
+            UBaseType_t uxDepth;
+            UBaseType_t uxMaxDepth = 0;
+            UBaseType_t uxChain;
+            UBaseType_t uxStage;
+            ListItem_t *pxTCB_Pointer;
+            ListItem_t *pxTCB_Next;
+
+            prvChainAssignDepths();
+
+            // Move the tasks out of the Task List ...
+            vListInitialise( &xUnsorted );
+            while( listLIST_IS_EMPTY( pxTASK_List ) == pdFALSE ){
+                pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxChainDepth > uxMaxDepth )
+                    uxMaxDepth = pxTCB->uxChainDepth;
+                uxListRemove( pxTCB_Pointer );
+                vListInsertEnd( &xUnsorted, pxTCB_Pointer );
+            }
+            // ... and insert them back by depth: the equal periods are kept in insertion order
+            for( uxDepth = 0; uxDepth <= uxMaxDepth; uxDepth++ ){
+                pxTCB_Pointer = listGET_HEAD_ENTRY( &xUnsorted );
+                while( pxTCB_Pointer != listGET_END_MARKER( &xUnsorted ) ){
+                    pxTCB_Next = listGET_NEXT( pxTCB_Pointer );
+                    pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                    if( pxTCB->uxChainDepth == uxDepth ){
+                        uxListRemove( pxTCB_Pointer );
+                        vListInsert( pxTASK_List, pxTCB_Pointer );
+                    }
+                    pxTCB_Pointer = pxTCB_Next;
+                }
+            }
+
+            // Align the offsets along the chains (a later chain wins on a task with several producers)
+            for( uxChain = 0; uxChain < configMAX_CHAINS; uxChain++ ){
+                for( uxStage = 1; uxStage < xChains[ uxChain ].uxLength; uxStage++ ){
+                    pxTCB = xChains[ uxChain ].pxStages[ uxStage ];
+                    pxProducer = xChains[ uxChain ].pxStages[ uxStage - 1 ];
+                    if( pxTCB->pxTrigger == NULL && pxProducer->pxTrigger == NULL && pxTCB->xPeriod == pxProducer->xPeriod &&
+                        pxTCB->uxChainDepth > pxProducer->uxChainDepth ){
+                        pxTCB->xArrivalTime = pxProducer->xArrivalTime;
+                        #if( configENABLE_SLACK_STEALING == 1 )
+                            pxTCB->xJobRelease = pxTCB->xArrivalTime + xStartTime;
+                        #endif
+                    }
+                }
+            }
+        }
+    #endif
+#endif
+
+#if( configENABLE_PARTITIONS == 1 )
+    /* Give each partition a band of priorities: the bands follow the RMS order of the reservations, each one holds the
+     * tasks of the partition above its Idle Task */
+    static void prvPartitionAssignBands(){
+        cPartition_t *pxPartition;
+        cTCB_t *pxTCB;
+        UBaseType_t uxPartition;
+        BaseType_t xTop = configSCHED_PRIO - 1;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ )
+            xPartitions[ uxPartition ].uxTasks = 0;
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            xPartitions[ pxTCB->uxPartition ].uxTasks++;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+
+        pxTCB_Pointer = listGET_HEAD_ENTRY( &xPartition_List );
+        pxTCB_Tail = listGET_END_MARKER( &xPartition_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            // The reservation is the first member of the partition
+            pxPartition = ( cPartition_t * ) listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxPartition->xServer.xPriority = xTop;
+            xTop -= pxPartition->uxTasks + 1;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
+
+    /* Supply bound function of a periodic resource (Shin-Lee): least time supplied in any window of length xT. The
+     * worst case starts right after a budget served at the beginning of its period and served at the end of the next ones */
+    static TickType_t prvPartitionSupplyBound( cPartition_t *pxPartition, TickType_t xBudget, TickType_t xT ){
+        TickType_t xPeriod = pxPartition->xServer.xPeriod;
+        TickType_t xBlackout = xPeriod - xBudget;
+        TickType_t xK = 1;
+
+        if( xT > xBlackout ){
+            xK = xT - xBlackout;
+            xK = CEIL( xK, xPeriod );
+        }
+        if( xT + 2 * xBudget >= ( xK + 1 ) * xPeriod && xT + xBudget <= ( xK + 1 ) * xPeriod )
+            return xT + ( xK + 1 ) * xBudget - ( xK + 1 ) * xPeriod;
+        return ( xK - 1 ) * xBudget;
+    }
+
+    #if( configENABLE_RM == 1 )
+        /* Request bound function of a task under RMS: its WCET and the jobs of the higher priority tasks of its partition
+         * released in a window of length xT */
+        static TickType_t prvPartitionRequestBound( ListItem_t *pxItem, TickType_t xT ){
+            cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+            cTCB_t *pxTCB_HigherPriority;
+            TickType_t xRequest = pxTCB->xWCET;
+            ListItem_t *pxTCB_HigherPriorityItem = listGET_HEAD_ENTRY( pxTASK_List );
+
+            while( pxTCB_HigherPriorityItem != pxItem ){
+                pxTCB_HigherPriority = listGET_LIST_ITEM_OWNER( pxTCB_HigherPriorityItem );
+                if( pxTCB_HigherPriority->uxPartition == pxTCB->uxPartition )
+                    xRequest += CEIL( xT, pxTCB_HigherPriority->xPeriod ) * pxTCB_HigherPriority->xWCET;
+                pxTCB_HigherPriorityItem = listGET_NEXT( pxTCB_HigherPriorityItem );
+            }
+            return xRequest;
+        }
+    #elif( configENABLE_EDF == 1 )
+        /* Demand bound function of a partition: WCET of its jobs with release and deadline in a window of length xT */
+        static TickType_t prvPartitionDemandBound( UBaseType_t uxPartition, TickType_t xT ){
+            cTCB_t *pxTCB;
+            TickType_t xDemand = 0;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition && xT >= pxTCB->xDeadline )
+                    xDemand += ( ( xT - pxTCB->xDeadline ) / pxTCB->xPeriod + 1 ) * pxTCB->xWCET;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return xDemand;
+        }
+    #endif
+
+    /* Local test of a partition on a budget: under RMS every task meets rbf(t) <= sbf(t) at one of its scheduling points,
+     * under EDF dbf(t) <= sbf(t) at every absolute deadline up to the hyperperiod */
+    static BaseType_t prvCheckPartitionLocal( UBaseType_t uxPartition, TickType_t xBudget ){
+        cPartition_t *pxPartition = &xPartitions[ uxPartition ];
+        cTCB_t *pxTCB;
+        TickType_t xT;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        #if( configENABLE_RM == 1 )
+            cTCB_t *pxTCB_HigherPriority;
+            ListItem_t *pxTCB_HigherPriorityItem;
+            BaseType_t xFound;
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition ){
+                    xFound = prvPartitionRequestBound( pxTCB_Pointer, pxTCB->xDeadline ) <=
+                             prvPartitionSupplyBound( pxPartition, xBudget, pxTCB->xDeadline );
+                    // Scheduling points: the releases of the task and of the higher priority ones before the deadline
+                    pxTCB_HigherPriorityItem = listGET_HEAD_ENTRY( pxTASK_List );
+                    while( xFound == pdFALSE ){
+                        pxTCB_HigherPriority = listGET_LIST_ITEM_OWNER( pxTCB_HigherPriorityItem );
+                        if( pxTCB_HigherPriority->uxPartition == uxPartition )
+                            for( xT = pxTCB_HigherPriority->xPeriod; xT < pxTCB->xDeadline && xFound == pdFALSE;
+                                 xT += pxTCB_HigherPriority->xPeriod )
+                                xFound = prvPartitionRequestBound( pxTCB_Pointer, xT ) <=
+                                         prvPartitionSupplyBound( pxPartition, xBudget, xT );
+                        if( pxTCB_HigherPriorityItem == pxTCB_Pointer )
+                            break;
+                        pxTCB_HigherPriorityItem = listGET_NEXT( pxTCB_HigherPriorityItem );
+                    }
+                    if( xFound == pdFALSE )
+                        return pdFALSE;
+                }
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+        #elif( configENABLE_EDF == 1 )
+            float xU = 0.0;
+            uint64_t ullHyperperiod = pxPartition->xServer.xPeriod;
+            uint64_t ullA;
+            uint64_t ullB;
+            uint64_t ullR;
+            TickType_t xHorizon = 0;
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition ){
+                    xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
+                    // Least common multiple of the periods and of the period of the reservation
+                    for( ullA = ullHyperperiod, ullB = pxTCB->xPeriod; ullB != 0; ullA = ullB, ullB = ullR )
+                        ullR = ullA % ullB;
+                    ullHyperperiod = ullHyperperiod / ullA * pxTCB->xPeriod;
+                    if( pxTCB->xDeadline > xHorizon )
+                        xHorizon = pxTCB->xDeadline;
+                }
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            // Every hyperperiod the supply grows by U_R times it and the demand by U: past the first one and the
+            // longest deadline the demand catches up with the supply only if U > U_R. Too long horizons are not checked
+            if( xU > (float) xBudget / pxPartition->xServer.xPeriod || ullHyperperiod > portMAX_DELAY / 2 )
+                return pdFALSE;
+            xHorizon += ( TickType_t ) ullHyperperiod;
+
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition )
+                    for( xT = pxTCB->xDeadline; xT <= xHorizon; xT += pxTCB->xPeriod )
+                        if( prvPartitionDemandBound( uxPartition, xT ) > prvPartitionSupplyBound( pxPartition, xBudget, xT ) )
+                            return pdFALSE;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        #endif
+
+        return pdTRUE;
+    }
+
+    /* Compositional test: the reservations are periodic tasks under the global RMS and the tasks of each partition are
+     * schedulable on the supply of its reservation. The smallest budget keeping each partition schedulable is printed */
+    static BaseType_t prvCheckFeasibilityPartitions( BaseType_t xVerbose ){
+        BaseType_t xFeasible = pdTRUE;
+        cPartition_t *pxPartition;
+        cTCB_t *pxTCB;
+        TickType_t xMinBudget;
+        UBaseType_t uxPartition;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( xPartitions[ pxTCB->uxPartition ].xServer.pcName == NULL ){
+                printf( "\nTask %s - Partition %lu not created\n", pxTCB->pcName, pxTCB->uxPartition );
+                return pdFALSE;
+            }
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ ){
+            pxPartition = &xPartitions[ uxPartition ];
+            // The Idle Task of the lowest band must still run above the idle priority
+            if( pxPartition->xServer.pcName != NULL &&
+                pxPartition->xServer.xPriority - ( BaseType_t ) pxPartition->uxTasks <= ( BaseType_t ) tskIDLE_PRIORITY ){
+                printf( "\nPartition %s - Not enough priorities for the bands\n", pxPartition->xServer.pcName );
+                return pdFALSE;
+            }
+        }
+
+        // Global level: the reservations are periodic tasks
+        if( listLIST_IS_EMPTY( &xPartition_List ) == pdTRUE || prvCheckFeasibilityWCRT( &xPartition_List, pdFALSE ) == pdFALSE )
+            xFeasible = pdFALSE;
+
+        // Local level: the budget must be at least the smallest one passing the local test
+        for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ ){
+            pxPartition = &xPartitions[ uxPartition ];
+            if( pxPartition->xServer.pcName == NULL )
+                continue;
+
+            for( xMinBudget = 1; xMinBudget <= pxPartition->xServer.xPeriod &&
+                 prvCheckPartitionLocal( uxPartition, xMinBudget ) == pdFALSE; xMinBudget++ );
+            if( xMinBudget > pxPartition->xServer.xWCET )
+                xFeasible = pdFALSE;
+            if( xVerbose == pdFALSE )
+                continue;
+
+            printf( "\nPartition %s - Period %lu - Budget %lu - Minimum budget ", pxPartition->xServer.pcName,
+                    pxPartition->xServer.xPeriod, pxPartition->xServer.xWCET );
+            if( xMinBudget > pxPartition->xServer.xPeriod )
+                printf( "none" );
+            else printf( "%lu", xMinBudget );
+            printf( " - WCRT %lu - Priority %ld\n", pxPartition->xServer.xWCRT, pxPartition->xServer.xPriority );
+
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition )
+                    printf( "    Task %s - Period %lu - WCET %lu - Deadline %lu\n", pxTCB->pcName, pxTCB->xPeriod,
+                            pxTCB->xWCET, pxTCB->xDeadline );
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        }
+        return xFeasible;
+    }
+
+    /* Put the tasks of a partition back in its band (budget replenished) or in background (budget exhausted) */
+    static void prvPartitionSetActive( UBaseType_t uxPartition, BaseType_t xActive ){
+        cPartition_t *pxPartition = &xPartitions[ uxPartition ];
+
+        pxPartition->xExhausted = ( xActive == pdTRUE ) ? pdFALSE : pdTRUE;
+        #if( configENABLE_EDF == 1 )
+            // The EDF scheduler places the tasks according to the flag
+            prvNotifySchedulerEDF();
+        #else
+            cTCB_t *pxTCB;
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->uxPartition == uxPartition )
+                    vTaskPrioritySet( *pxTCB->pxTaskHandle, ( xActive == pdTRUE ) ? ( UBaseType_t ) pxTCB->xPriority : tskIDLE_PRIORITY );
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+        #endif
+        // The Idle Task would run the budget of the other partitions down
+        if( xActive == pdTRUE )
+            vTaskResume( pxPartition->xIdleHandle );
+        else vTaskSuspend( pxPartition->xIdleHandle );
+    }
+
+    /* Charge the tick to the partition running (its tasks or its Idle Task) and wake up the Partitions Task at the
+     * exhaustion or replenishment of a budget */
+    static void prvPartitionTick( TaskHandle_t xCurrentTaskHandle, cTCB_t *pxTask ){
+        cPartition_t *pxPartition = NULL;
+        TickType_t xNow = xTaskGetTickCountFromISR();
+        BaseType_t xNotify = pdFALSE;
+        UBaseType_t uxPartition;
+
+        if( pxTask != NULL )
+            pxPartition = &xPartitions[ pxTask->uxPartition ];
+        for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ ){
+            if( xPartitions[ uxPartition ].xIdleHandle == NULL )
+                continue;
+            if( xPartitions[ uxPartition ].xIdleHandle == xCurrentTaskHandle )
+                pxPartition = &xPartitions[ uxPartition ];
+            if( ( TickType_t ) ( xNow - xPartitions[ uxPartition ].xNextReplenish ) <= ( portMAX_DELAY >> 1 ) )
+                xNotify = pdTRUE;
+        }
+
+        // The tasks of an exhausted partition run in background, for free
+        if( pxPartition != NULL && pxPartition->xRemaining > 0 ){
+            pxPartition->xRemaining--;
+            if( pxPartition->xRemaining == 0 )
+                xNotify = pdTRUE;
+        }
+        if( xNotify == pdTRUE && xPartitionsHandle != NULL ){
+            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR( xPartitionsHandle, &xHigherPriorityTaskWoken );
+            portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+        }
+    }
+
+    /* Idle Task of a partition: it consumes the budget while no job of the partition is ready (idling periodic server),
+     * so that the supply never comes later than the analysis assumes */
+    static void prvPartitionIdleCode( void *pvParameters ){
+        ( void ) pvParameters;
+        for( ; ; ){
+        }
+    }
+
+    /* Partitions Task: it replenishes the budgets at the start of their periods and moves the partitions that exhausted
+     * them in background */
+    static void prvPartitionsCode(){
+        cPartition_t *pxPartition;
+        cTCB_t *pxTCB;
+        TickType_t xNow;
+        UBaseType_t uxPartition;
+        UBaseType_t uxPending;
+
+        for( ; ; ){
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+            xNow = xTaskGetTickCount();
+
+            for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ ){
+                pxPartition = &xPartitions[ uxPartition ];
+                if( pxPartition->xIdleHandle == NULL )
+                    continue;
+
+                // Replenishment times reached, compared as elapsed times across the tick wraparound
+                if( ( TickType_t ) ( xNow - pxPartition->xNextReplenish ) <= ( portMAX_DELAY >> 1 ) ){
+                    while( ( TickType_t ) ( xNow - pxPartition->xNextReplenish ) <= ( portMAX_DELAY >> 1 ) )
+                        pxPartition->xNextReplenish += pxPartition->xServer.xPeriod;
+                    pxPartition->xRemaining = pxPartition->xServer.xWCET;
+                    if( pxPartition->xExhausted == pdTRUE )
+                        prvPartitionSetActive( uxPartition, pdTRUE );
+                }else if( pxPartition->xRemaining == 0 && pxPartition->xExhausted == pdFALSE ){
+                    prvPartitionSetActive( uxPartition, pdFALSE );
+
+                    // The budget is usually exhausted by the Idle Task: report only the jobs left waiting
+                    uxPending = 0;
+                    ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+                    const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+                    while( pxTCB_Pointer != pxTCB_Tail ){
+                        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                        if( pxTCB->uxPartition == uxPartition && pxTCB->xTaskJobStatus == pdFALSE )
+                            uxPending++;
+                        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                    }
+                    if( uxPending > 0 )
+                        printf( "\n[EXHAUSTED] Tick count %lu - Partition %s - %lu jobs pending until %lu\n", xNow,
+                                pxPartition->xServer.pcName, uxPending, pxPartition->xNextReplenish );
+                }
+            }
+        }
+    }
+
+    /* Create the Idle Task of every partition, at the bottom of its band, and the Partitions Task */
+    static void prvPartitionsCreate(){
+        cPartition_t *pxPartition;
+        UBaseType_t uxPartition;
+
+        for( uxPartition = 0; uxPartition < configMAX_PARTITIONS; uxPartition++ ){
+            pxPartition = &xPartitions[ uxPartition ];
+            if( pxPartition->xServer.pcName == NULL )
+                continue;
+            xTaskCreate( prvPartitionIdleCode,
+                         pxPartition->cIdleName,
+                         configMINIMAL_STACK_SIZE,
+                         NULL,
+                         pxPartition->xServer.xPriority - pxPartition->uxTasks,
+                         &pxPartition->xIdleHandle);
+        }
+        xTaskCreate( prvPartitionsCode,
+                     "Partitions",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xPartitionsHandle);
+    }
+#endif
+
+#if( configENABLE_DUAL_PRIORITY == 1 )
+    /* Promotion Task: sleep until the earliest promotion and raise every hard job still pending at its release
+     * plus D - R to the upper band, where the WCRT analysis holds */
+    static void prvPromotionCode(){
+        TickType_t xNow, xWait;
+        cTCB_t *pxTCB;
+
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xNextPromotion = xStartTime + pxTCB->xArrivalTime + pxTCB->xPromotion;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+
+        for( ;; ){
+            xNow = xTaskGetTickCount();
+            xWait = portMAX_DELAY;
+
+            // The promotion times are compared as offsets from xNow, across the tick wraparound
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xSoft == pdFALSE ){
+                    if( ( TickType_t ) ( xNow - pxTCB->xNextPromotion ) <= ( portMAX_DELAY >> 1 ) ){
+                        printf("\n[PROMOTED] Tick count %lu - Task %s - Release %lu\n", xNow, pxTCB->pcName,
+                               pxTCB->xNextPromotion - pxTCB->xPromotion);
+                        vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+                        pxTCB->xNextPromotion += pxTCB->xPeriod;
+                    }
+                    if( ( TickType_t ) ( pxTCB->xNextPromotion - xNow ) < xWait )
+                        xWait = pxTCB->xNextPromotion - xNow;
+                }
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+            if( xWait == portMAX_DELAY )
+                vTaskSuspend( NULL );
+            else if( xWait > 0 )
+                vTaskDelayUntil( &xNow, xWait );
+        }
+    }
+
+    /* Create the Promotion Task */
+    static void prvDualPriorityCreate(){
+        xTaskCreate( prvPromotionCode,
+                     "Promotion",
+                     configSCHED_MAX_STACK_DEPTH,
+                     NULL,
+                     configSCHED_PRIO,
+                     &xPromotionHandle);
+    }
+#endif
+
+#if( configENABLE_LIMITED_PREEMPTION == 1 )
+    /* Work of the task and of the higher priority ones released in [0, t) (W_k(t)) */
+    static TickType_t prvGetWorkload( ListItem_t *pxItem, TickType_t xT ){
+        cTCB_t *pxTCB = listGET_LIST_ITEM_OWNER( pxItem );
+        TickType_t xW = pxTCB->xWCET;
+
+        ListItem_t *pxHigherPriority_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        while( pxHigherPriority_Pointer != pxItem ){
+            cTCB_t *pxHigherPriority = listGET_LIST_ITEM_OWNER( pxHigherPriority_Pointer );
+            xW += CEIL( xT, pxHigherPriority->xPeriod ) * pxHigherPriority->xWCET;
+            pxHigherPriority_Pointer = listGET_NEXT( pxHigherPriority_Pointer );
+        }
+        return xW;
+    }
+
+    /* NPR length of every task (Yao-Buttazzo-Bertogna): the smallest blocking tolerance of the higher priority tasks,
+     * the largest t - W_k(t) at the scheduling points of task k. B_i is the longest region of a lower priority task */
+    static void prvAssignNPRLengths(){
+        cTCB_t *pxTCB;
+        cTCB_t *pxOther;
+        ListItem_t *pxTCB_Pointer;
+        ListItem_t *pxOther_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        TickType_t xMinTolerance = portMAX_DELAY;
+        TickType_t xTolerance, xT, xW;
+        uint64_t ullHyperperiod = 1, ullA, ullB, ullR;
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            // Nobody can be blocked by the highest priority task: its jobs are non-preemptive from start to end
+            pxTCB->xNPRLength = ( xMinTolerance < pxTCB->xWCET ) ? xMinTolerance : pxTCB->xWCET;
+
+            // Scheduling points: the deadline and the releases of the higher priority tasks before it
+            xTolerance = 0;
+            xW = prvGetWorkload( pxTCB_Pointer, pxTCB->xDeadline );
+            if( xW <= pxTCB->xDeadline )
+                xTolerance = pxTCB->xDeadline - xW;
+            for( pxOther_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxOther_Pointer != pxTCB_Pointer;
+                 pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                for( xT = pxOther->xPeriod; xT < pxTCB->xDeadline; xT += pxOther->xPeriod ){
+                    xW = prvGetWorkload( pxTCB_Pointer, xT );
+                    if( xW <= xT && xT - xW > xTolerance )
+                        xTolerance = xT - xW;
+                }
+            }
+            if( xTolerance < xMinTolerance )
+                xMinTolerance = xTolerance;
+
+            for( ullA = ullHyperperiod, ullB = pxTCB->xPeriod; ullB != 0; ullA = ullB, ullB = ullR )
+                ullR = ullA % ullB;
+            ullHyperperiod = ullHyperperiod / ullA * pxTCB->xPeriod;
+            if( ullHyperperiod > portMAX_DELAY / 2 )
+                ullHyperperiod = portMAX_DELAY / 2;
+        }
+        xHyperperiod = ( TickType_t ) ullHyperperiod;
+        xNextReport = xStartTime + xHyperperiod;
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xBlocking = 0;
+            for( pxOther_Pointer = listGET_NEXT( pxTCB_Pointer ); pxOther_Pointer != pxTCB_Tail;
+                 pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                if( pxOther->xNPRLength > pxTCB->xBlocking )
+                    pxTCB->xBlocking = pxOther->xNPRLength;
+            }
+            printf("Task %s - NPR length %lu - Blocking %lu\n", pxTCB->pcName, pxTCB->xNPRLength, pxTCB->xBlocking);
+        }
+    }
+
+    /* Enter a non-preemptive region: the job runs at the highest priority of the periodic tasks */
+    static void prvNPREnter( cTCB_t *pxTask ){
+        if( pxTask->xNPRLength == 0 )
+            return;
+        pxTask->xNPRTime = 0;
+        pxTask->xInNPR = pdTRUE;
+        vTaskPrioritySet( NULL, xNPRCeiling );
+    }
+
+    /* Exit the non-preemptive region (unless the NPR Task closed it already): the jobs released meanwhile preempt the job */
+    static void prvNPRExit( cTCB_t *pxTask ){
+        if( pxTask->xInNPR == pdFALSE )
+            return;
+        pxTask->xInNPR = pdFALSE;
+        vTaskPrioritySet( NULL, pxTask->xPriority );
+    }
+
+    /* A job starting while another one is in progress preempts the highest priority one of them. The preemptions are
+     * reported at the first job of every hyperperiod */
+    static void prvCountPreemption( cTCB_t *pxTask, TickType_t xStartTick ){
+        cTCB_t *pxTCB;
+        cTCB_t *pxPreempted = NULL;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        if( ( TickType_t ) ( xStartTick - xNextReport ) <= ( portMAX_DELAY >> 1 ) ){
+            printf( "\n[PREEMPTIONS] Tick count %lu - Hyperperiod ending at %lu - Preemptions %lu\n", xStartTick, xNextReport,
+                    uxPreemptions );
+            for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                 pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                printf( "    Task %s - Preemptions %lu\n", pxTCB->pcName, pxTCB->uxPreemptions );
+                pxTCB->uxPreemptions = 0;
+            }
+            uxPreemptions = 0;
+            while( ( TickType_t ) ( xStartTick - xNextReport ) <= ( portMAX_DELAY >> 1 ) )
+                xNextReport += xHyperperiod;
+        }
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB != pxTask && pxTCB->xTaskJobStatus == pdFALSE &&
+                ( pxPreempted == NULL || pxTCB->xPriority > pxPreempted->xPriority ) )
+                pxPreempted = pxTCB;
+        }
+        if( pxPreempted != NULL ){
+            pxPreempted->uxPreemptions++;
+            uxPreemptions++;
+        }
+    }
+
+    /* NPR Task: close the regions reaching their NPR length, so no job is blocked longer than the analysis assumes */
+    static void prvNPRCode(){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( ;; ){
+            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+            for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                 pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xInNPR == pdTRUE && pxTCB->xNPRTime >= pxTCB->xNPRLength ){
+                    pxTCB->xInNPR = pdFALSE;
+                    vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+                    printf( "\n[NPR EXPIRED] Tick count %lu - Task %s - NPR length %lu\n", xTaskGetTickCount(), pxTCB->pcName,
+                            pxTCB->xNPRLength );
+                }
+            }
+        }
+    }
+#endif
+
+#if( configENABLE_COROUTINES == 1 )
+    /* Move a periodic job without stack from the Task List to the Co-routines List, sorted by deadline */
+    static void prvCoRoutineRegister( cTCB_t *pxTCB ){
+        uxListRemove( &pxTCB->pxTCBItem );
+        listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xDeadline );
+        vListInsert( &xCoRoutine_List, &pxTCB->pxTCBItem );
+    }
+
+    /* Deadline monotonic priorities of the co-routines: the longest deadlines beyond the available priorities share
+     * the lowest one, where they run in order of release */
+    static void prvAssignPriorityCoRoutines(){
+        BaseType_t xPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
+        TickType_t xDeadline = 0;
+        cTCB_t *pxTCB;
+
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( &xCoRoutine_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( &xCoRoutine_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            // Equal deadlines share a priority
+            if( xDeadline != 0 && pxTCB->xDeadline != xDeadline && xPriority > 0 )
+                xPriority--;
+            xDeadline = pxTCB->xDeadline;
+            pxTCB->xPriority = xPriority;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
+
+    /* Master of the co-routine jobs: the TCB is passed as index, since nothing on the stack survives a crDELAY */
+    static void prvCoRoutineMaster( CoRoutineHandle_t xHandle, UBaseType_t uxIndex ){
+        cTCB_t *pxTCB = ( cTCB_t * ) uxIndex;
+        TickType_t xNow;
+
+        crSTART( xHandle );
+
+        pxTCB->xLastWakeTime = xStartTime + pxTCB->xArrivalTime;
+        for( ;; ){
+            // The co-routine tick count stands still while a job runs: the release is checked on the kernel one
+            while( ( TickType_t ) ( xTaskGetTickCount() - pxTCB->xLastWakeTime ) > ( portMAX_DELAY >> 1 ) ){
+                crDELAY( xHandle, pxTCB->xLastWakeTime - xTaskGetTickCount() );
+            }
+
+            printf("\n[START] Tick count %lu - Co-routine %s - LastWakeTime %lu - Priority %ld\n", xTaskGetTickCount(),
+                   pxTCB->pcName, pxTCB->xLastWakeTime, pxTCB->xPriority);
+            // The job runs to completion: only the tasks preempt it. It runs in the Idle Task, which must never block
+            pxTCB->pxTaskCode( pxTCB->pvParameters );
+            xNow = xTaskGetTickCount();
+            printf("\n[END] Response time %lu (WCRT: %lu) - Co-routine %s\n", xNow - pxTCB->xLastWakeTime, pxTCB->xWCRT,
+                   pxTCB->pcName);
+            if( xNow - pxTCB->xLastWakeTime > pxTCB->xDeadline )
+                printf("\n[DEADLINE MISS] Tick count %lu - Co-routine %s - Deadline %lu\n", xNow, pxTCB->pcName,
+                       pxTCB->xLastWakeTime + pxTCB->xDeadline);
+            pxTCB->xLastWakeTime += pxTCB->xPeriod;
+
+            // Back to the Idle Task between two jobs, even a late one
+            crDELAY( xHandle, 0 );
+        }
+
+        crEND();
+    }
+
+    /* Create a co-routine for each job of the Co-routines List (a few words each instead of a task stack) */
+    static void prvCoRoutinesCreate(){
+        UBaseType_t uxCoRoutines = 0;
+        cTCB_t *pxTCB;
+
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( &xCoRoutine_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( &xCoRoutine_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( xCoRoutineCreate( prvCoRoutineMaster, pxTCB->xPriority, ( UBaseType_t ) pxTCB ) == pdPASS )
+                uxCoRoutines++;
+            else printf("\nCo-routine %s NOT CREATED\n", pxTCB->pcName);
             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
         }
+        if( uxCoRoutines > 0 )
+            printf("\n%lu co-routines on the stack of the Idle Task\n", uxCoRoutines);
+    }
+
+    #if( configENABLE_FIXED == 0 )
+        /* WCRT of the co-routine jobs: they run in background, so every task and every co-routine ahead in the list
+         * interferes. Once started a job is not preempted by the other co-routines: it is blocked by the longest
+         * lower priority job and by the equal priority ones (served in order of release) */
+        static BaseType_t prvCheckFeasibilityCoRoutines( BaseType_t xVerbose ){
+            TickType_t xR, xI, xB;
+            cTCB_t *pxTCB;
+            cTCB_t *pxOther;
+            ListItem_t *pxOther_Pointer;
+
+            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( &xCoRoutine_List );
+            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( &xCoRoutine_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+
+                xB = 0;
+                xI = 0;
+                for( pxOther_Pointer = listGET_NEXT( pxTCB_Pointer ); pxOther_Pointer != pxTCB_Tail;
+                     pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                    pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                    if( pxOther->xPriority == pxTCB->xPriority )
+                        xI += pxOther->xWCET;
+                    else if( pxOther->xWCET > xB )
+                        xB = pxOther->xWCET;
+                }
+                xB += xI;
+                #if( configENABLE_BACKGROUND == 1 )
+                    // A chunk of background work started by the Idle Task is not preempted by the co-routines
+                    xB += configBACKGROUND_MAX_CHUNK;
+                #endif
+
+                xR = xB + pxTCB->xWCET;
+                while( xR <= pxTCB->xDeadline ){
+                    xI = xB + pxTCB->xWCET;
+                    for( pxOther_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxOther_Pointer != listGET_END_MARKER( pxTASK_List );
+                         pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                        pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                        xI += CEIL( xR, pxOther->xPeriod ) * pxOther->xWCET;
+                    }
+                    for( pxOther_Pointer = listGET_HEAD_ENTRY( &xCoRoutine_List ); pxOther_Pointer != pxTCB_Pointer;
+                         pxOther_Pointer = listGET_NEXT( pxOther_Pointer ) ){
+                        pxOther = listGET_LIST_ITEM_OWNER( pxOther_Pointer );
+                        xI += CEIL( xR, pxOther->xPeriod ) * pxOther->xWCET;
+                    }
+                    if( xI == xR )
+                        break;
+                    xR = xI;
+                }
+                pxTCB->xWCRT = xR;
+
+                if( xVerbose == pdTRUE )
+                    printf("\nCo-routine %s - WCET %lu - WCRT %lu - Priority %ld\n", pxTCB->pcName, pxTCB->xWCET,
+                           pxTCB->xWCRT, pxTCB->xPriority);
+                if( xR > pxTCB->xDeadline )
+                    return pdFALSE;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+            return pdTRUE;
+        }
+    #endif
+#endif
+
+#if( configENABLE_LET == 1 )
+    /* A buffer is written again by the writer N - 1 jobs after it has been published, so a reader latching it just before
+     * the next publication must complete (by its deadline) within (N - 1) periods of the writer minus its deadline */
+    static BaseType_t prvCheckLETPorts(){
+        BaseType_t xFeasible = pdTRUE;
+        cLETPort_t *pxPort;
+        cTCB_t *pxReader;
+        UBaseType_t uxPort, i;
+
+        for( uxPort = 0; uxPort < configMAX_LET_PORTS; uxPort++ ){
+            pxPort = &xLETPorts[ uxPort ];
+            if( pxPort->pxWriter == NULL )
+                continue;
+            printf("\nLET port %s - Writer %s - Buffers %lu\n", pxPort->pcName, pxPort->pxWriter->pcName, pxPort->uxBuffers);
+            if( pxPort->pxWriter->xDeadline > pxPort->pxWriter->xPeriod )
+                xFeasible = pdFALSE;
+            for( i = 0; i < pxPort->uxReaders; i++ ){
+                pxReader = pxPort->pxReaders[ i ];
+                if( pxPort->pxWriter->xDeadline + pxReader->xDeadline > ( pxPort->uxBuffers - 1 ) * pxPort->pxWriter->xPeriod ){
+                    printf("Reader %s - Deadline %lu - Overwritten after %lu\n", pxReader->pcName, pxReader->xDeadline,
+                           ( pxPort->uxBuffers - 1 ) * pxPort->pxWriter->xPeriod - pxPort->pxWriter->xDeadline);
+                    xFeasible = pdFALSE;
+                }
+            }
+        }
+        if( xFeasible == pdFALSE ){
+            printf("\nLET PORTS CHECK FAILED - A buffer is overwritten while read - EXITING PROGRAM\n");
+            return pdFALSE;
+        }
+        printf("\nLET PORTS CHECK PASSED\n");
+        return pdTRUE;
+    }
 
-        #if( configENABLE_RM == 1 )
-            if( xU > 2.0 ){
-                printf("\nU_max > 2\n");
-                return pdFALSE;
+    /* Schedule the first instants of every port from the start of the scheduler, and process the ones falling on it */
+    static void prvLETStart(){
+        cLETPort_t *pxPort;
+        UBaseType_t uxPort, i;
+
+        for( uxPort = 0; uxPort < configMAX_LET_PORTS; uxPort++ ){
+            pxPort = &xLETPorts[ uxPort ];
+            if( pxPort->pxWriter == NULL )
+                continue;
+            // Until the first publication the readers get the initial value
+            pxPort->uxPublished = 0;
+            pxPort->uxWriting = 1;
+            pxPort->xNextRelease = xStartTime + pxPort->pxWriter->xArrivalTime;
+            pxPort->xNextPublish = pxPort->xNextRelease + pxPort->pxWriter->xDeadline;
+            for( i = 0; i < pxPort->uxReaders; i++ ){
+                pxPort->pvLatched[ i ] = pxPort->pvBuffers[ 0 ];
+                pxPort->xNextLatch[ i ] = xStartTime + pxPort->pxReaders[ i ]->xArrivalTime;
             }
+        }
+        prvLETTick( xStartTime );
+    }
 
-        #elif( configENABLE_EDF == 1 )
-            if( xU > 1.0 ){
-                printf("\nU_max > 1\n");
+    /* Instants of the Logical Execution Time (TickHook): the outputs of the writers reaching their deadline are published
+     * and the inputs of the readers released are latched, by swapping pointers only */
+    static void prvLETTick( TickType_t xNow ){
+        cLETPort_t *pxPort;
+        UBaseType_t uxPort, i;
+
+        // Outputs first: a reader released at the deadline of the writer reads the new data
+        for( uxPort = 0; uxPort < configMAX_LET_PORTS; uxPort++ ){
+            pxPort = &xLETPorts[ uxPort ];
+            if( pxPort->pxWriter == NULL || xNow != pxPort->xNextPublish )
+                continue;
+            // The output of a late job is not published, the readers keep the previous one
+            if( pxPort->pxWriter->xLETDone == pdTRUE )
+                pxPort->uxPublished = pxPort->uxWriting;
+            pxPort->xNextPublish += pxPort->pxWriter->xPeriod;
+        }
+
+        for( uxPort = 0; uxPort < configMAX_LET_PORTS; uxPort++ ){
+            pxPort = &xLETPorts[ uxPort ];
+            if( pxPort->pxWriter == NULL )
+                continue;
+            if( xNow == pxPort->xNextRelease ){
+                // The writer gets the buffer published longest ago
+                pxPort->uxWriting = ( pxPort->uxPublished + 1 ) % pxPort->uxBuffers;
+                pxPort->pxWriter->xLETDone = pdFALSE;
+                pxPort->xNextRelease += pxPort->pxWriter->xPeriod;
+            }
+            for( i = 0; i < pxPort->uxReaders; i++ ){
+                if( xNow != pxPort->xNextLatch[ i ] )
+                    continue;
+                pxPort->pvLatched[ i ] = pxPort->pvBuffers[ pxPort->uxPublished ];
+                pxPort->xNextLatch[ i ] += pxPort->pxReaders[ i ]->xPeriod;
+            }
+        }
+    }
+#endif
+
+#if( configENABLE_ELASTIC == 1 )
+    /* Elastic compression of the Task List to the desired utilisation xUd: the excess is taken from the elastic tasks in
+     * proportion to their coefficients, and a task reaching its longest period leaves the compression (the excess is
+     * shared again among the others). pdFALSE if the load is above xUd even at the longest periods */
+    static BaseType_t prvElasticCompress( float xUd ){
+        float xUFixed, xUElastic, xElasticity, xU;
+        BaseType_t xDone = pdFALSE;
+        TickType_t xPeriod;
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xElasticFixed = ( pxTCB->uxElasticity == 0 || pxTCB->xWCET == 0 ) ? pdTRUE : pdFALSE;
+        }
+
+        while( xDone == pdFALSE ){
+            xUFixed = 0.0;
+            xUElastic = 0.0;
+            xElasticity = 0.0;
+            for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                 pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xElasticFixed == pdTRUE ){
+                    // The rigid tasks keep the nominal period, the elastic ones are stuck at the longest
+                    if( pxTCB->uxElasticity == 0 || pxTCB->xWCET == 0 )
+                        pxTCB->xPeriod = pxTCB->xPeriodMin;
+                    else pxTCB->xPeriod = pxTCB->xPeriodMax;
+                    xUFixed += (float) pxTCB->xWCET / pxTCB->xPeriod;
+                }else{
+                    xUElastic += (float) pxTCB->xWCET / pxTCB->xPeriodMin;
+                    xElasticity += pxTCB->uxElasticity;
+                }
+            }
+            if( xUFixed > xUd )
                 return pdFALSE;
+
+            xDone = pdTRUE;
+            for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+                 pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                if( pxTCB->xElasticFixed == pdTRUE )
+                    continue;
+
+                xU = (float) pxTCB->xWCET / pxTCB->xPeriodMin;
+                if( xUFixed + xUElastic > xUd )
+                    xU -= ( xUFixed + xUElastic - xUd ) * pxTCB->uxElasticity / xElasticity;
+                if( xU <= (float) pxTCB->xWCET / pxTCB->xPeriodMax ){
+                    pxTCB->xElasticFixed = pdTRUE;
+                    xDone = pdFALSE;
+                    continue;
+                }
+                // Rounded up to the tick, so that the utilisation stays below the share assigned
+                xPeriod = (TickType_t) ( pxTCB->xWCET / xU );
+                if( (float) pxTCB->xWCET / xPeriod > xU )
+                    xPeriod++;
+                if( xPeriod < pxTCB->xPeriodMin )
+                    xPeriod = pxTCB->xPeriodMin;
+                pxTCB->xPeriod = ( xPeriod > pxTCB->xPeriodMax ) ? pxTCB->xPeriodMax : xPeriod;
             }
-        #endif
+        }
 
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->xImplicitDeadline == pdTRUE )
+                pxTCB->xDeadline = pxTCB->xPeriod;
+        }
         return pdTRUE;
     }
 
-    /* Feasibility Test with Worst Case Response Time*/
-    static BaseType_t prvCheckFeasibilityWCRT( void ){
-        TickType_t xI;
+    /* Look for the largest desired utilisation (from 1 down by configELASTIC_STEP percent) whose compressed periods pass
+     * the WCRT test: they are left in xPeriodNext (the old ones if pdFALSE), the periods in use are not changed */
+    static BaseType_t prvElasticCompute(){
+        BaseType_t xFeasible = pdFALSE;
+        BaseType_t xUd;
+        TickType_t xPeriod;
+        TickType_t xWCET;
         cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        // The test runs on the compressed periods and the WCETs given last: the ones in use are saved meanwhile
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xPeriodNext = pxTCB->xPeriod;
+            xWCET = pxTCB->xWCET;
+            pxTCB->xWCET = pxTCB->xWCETNext;
+            pxTCB->xWCETNext = xWCET;
+        }
+
+        for( xUd = 100; xUd > 0 && xFeasible == pdFALSE; xUd -= configELASTIC_STEP ){
+            if( prvElasticCompress( (float) xUd / 100 ) == pdFALSE )
+                break;
+            xFeasible = prvCheckFeasibilityWCRT( pxTASK_List, pdFALSE );
+        }
+
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            xPeriod = pxTCB->xPeriod;
+            pxTCB->xPeriod = pxTCB->xPeriodNext;
+            if( xFeasible == pdTRUE )
+                pxTCB->xPeriodNext = xPeriod;
+            xWCET = pxTCB->xWCETNext;
+            pxTCB->xWCETNext = pxTCB->xWCET;
+            pxTCB->xWCET = xWCET;
+            if( pxTCB->xImplicitDeadline == pdTRUE )
+                pxTCB->xDeadline = pxTCB->xPeriod;
+        }
+        return xFeasible;
+    }
 
+    /* Apply the compressed periods before the first release */
+    static void prvElasticStart(){
+        cTCB_t *pxTCB;
         ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
         const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
-        // Initialize R with WCET of the highest priority task
-        TickType_t xR = pxTCB->xWCET;
-        printf("\nTask %s - WCET %lu - WCRT %lu\n", pxTCB->pcName, pxTCB->xWCET, pxTCB->xWCRT);
+        printf( "\nELASTIC PERIODS\n" );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xPeriod = pxTCB->xPeriodNext;
+            if( pxTCB->xImplicitDeadline == pdTRUE )
+                pxTCB->xDeadline = pxTCB->xPeriod;
+            #if( configENABLE_EDF == 1 )
+                // The Scheduler Task sorts the list again at its first activation
+                pxTCB->ullAbsDeadline = pxTCB->xDeadline + pxTCB->xArrivalTime + prvExtendTime( xStartTime );
+            #endif
+            if( pxTCB->uxElasticity > 0 )
+                printf( "Task %s - Period %lu (min %lu - max %lu) - Elasticity %lu\n", pxTCB->pcName, pxTCB->xPeriod,
+                        pxTCB->xPeriodMin, pxTCB->xPeriodMax, pxTCB->uxElasticity );
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
 
-        /*If the highest priority task has an execution time bigger than his period
-         * the schedulability is already not feasible */
-        if( pxTCB->xWCRT > pxTCB->xPeriod )
-            return pdFALSE;
+    /* pdTRUE while a task still runs with a period shorter than the one found by the last compression */
+    static BaseType_t prvElasticStretching(){
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
-        // Take the next task
-        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->xPeriodNext > pxTCB->xPeriod )
+                return pdTRUE;
+        }
+        return pdFALSE;
+    }
+
+    /* Apply at the job boundary the period found by the last compression (or relaxation), then the heavier WCET given
+     * at runtime once every stretched period is in use */
+    static void prvElasticApply( cTCB_t *pxTCB ){
+        TickType_t xPeriod, xWCET;
+        TickType_t xPeriodNext, xWCETNext;
+
+        // A new load can be admitted meanwhile by a task of higher priority
+        vTaskSuspendAll();
+        xPeriod = pxTCB->xPeriod;
+        xPeriodNext = pxTCB->xPeriodNext;
+        pxTCB->xPeriod = xPeriodNext;
+        if( pxTCB->xImplicitDeadline == pdTRUE )
+            pxTCB->xDeadline = xPeriodNext;
+        xWCET = pxTCB->xWCET;
+        xWCETNext = pxTCB->xWCETNext;
+        if( xWCETNext > xWCET && prvElasticStretching() == pdFALSE )
+            pxTCB->xWCET = xWCETNext;
+        else xWCETNext = xWCET;
+        xTaskResumeAll();
+
+        if( xPeriodNext != xPeriod )
+            printf( "\n[ELASTIC] Tick count %lu - Task %s - Period %lu -> %lu\n", xTaskGetTickCount(), pxTCB->pcName,
+                    xPeriod, xPeriodNext );
+        if( xWCETNext != xWCET )
+            printf( "\n[ELASTIC] Tick count %lu - Task %s - WCET %lu -> %lu\n", xTaskGetTickCount(), pxTCB->pcName,
+                    xWCET, xWCETNext );
+    }
+#endif
+
+#if( configENABLE_OVERLOAD == 1 )
+    /* A job is pending from its release until its completion (the absolute deadline is the one of the next job after) */
+    static BaseType_t prvOverloadPending( cTCB_t *pxTCB, uint64_t ullNow ){
+        if( pxTCB->xTaskJobStatus == pdFALSE )
+            return pdTRUE;
+        return ( pxTCB->ullAbsDeadline - pxTCB->xDeadline <= ullNow ) ? pdTRUE : pdFALSE;
+    }
+
+    /* Compare a job with the victim found so far: pdTRUE if it is worth less (the later deadline on ties) */
+    static BaseType_t prvOverloadLess( cTCB_t *pxTCB, cTCB_t *pxVictim ){
+        #if( configOVERLOAD_POLICY == OVERLOAD_DENSITY )
+            // Value per tick of WCET, compared without divisions
+            return ( (uint64_t) pxTCB->uxValue * pxVictim->xWCET <= (uint64_t) pxVictim->uxValue * pxTCB->xWCET ) ? pdTRUE
+                                                                                                                  : pdFALSE;
+        #else
+            return ( pxTCB->uxValue <= pxVictim->uxValue ) ? pdTRUE : pdFALSE;
+        #endif
+    }
+
+    /* Robust EDF: the pending jobs are walked by deadline adding up their residual WCETs. At the first job completing
+     * after its deadline (plus tolerance), the job of least value among the ones walked is rejected and the walk starts
+     * again. A started job can not be aborted, so only the jobs not started yet are rejected. pdTRUE if the job of pxTask
+     * (about to start) is rejected, otherwise it is marked as started before any other check can run */
+    static BaseType_t prvOverloadCheck( cTCB_t *pxTask ){
+        BaseType_t xRejected;
+        uint64_t ullNow, ullFinish;
+        cTCB_t *pxTCB;
+        cTCB_t *pxVictim;
+        BaseType_t xOverload = pdTRUE;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        // The Task List is neither sorted nor changed by the other jobs meanwhile
+        vTaskSuspendAll();
+        ullNow = ullGetTickCount64();
+        while( xOverload == pdTRUE ){
+            xOverload = pdFALSE;
+            ullFinish = ullNow;
+            pxVictim = NULL;
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail && xOverload == pdFALSE ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                if( pxTCB->xRejected == pdTRUE || prvOverloadPending( pxTCB, ullNow ) == pdFALSE )
+                    continue;
+
+                if( pxTCB->xTaskJobStatus == pdTRUE ){
+                    ullFinish += pxTCB->xWCET;
+                    if( pxVictim == NULL || prvOverloadLess( pxTCB, pxVictim ) == pdTRUE )
+                        pxVictim = pxTCB;
+                }else if( pxTCB->xTimeSpent < pxTCB->xWCET )
+                    ullFinish += pxTCB->xWCET - pxTCB->xTimeSpent;
+
+                // A job late because of the started ones only is left to complete
+                if( ullFinish > pxTCB->ullAbsDeadline + pxTCB->xTolerance && pxVictim != NULL ){
+                    pxVictim->xRejected = pdTRUE;
+                    xOverload = pdTRUE;
+                }
+            }
+        }
+        xRejected = pxTask->xRejected;
+        if( xRejected == pdFALSE )
+            pxTask->xTaskJobStatus = pdFALSE;
+        xTaskResumeAll();
+        return xRejected;
+    }
+
+    /* Skip the rejected job: the next one takes its place in the EDF order */
+    static void prvOverloadReject( cTCB_t *pxTask ){
+        pxTask->xRejected = pdFALSE;
+        uxValueRejected += pxTask->uxValue;
+        uxJobsRejected++;
+        printf( "\n[OVERLOAD] Tick count %lu - Task %s rejected - Value %lu - LastWakeTime %lu\n", xTaskGetTickCount(),
+                pxTask->pcName, pxTask->uxValue, pxTask->xLastWakeTime );
+        pxTask->ullAbsDeadline = prvExtendTime( pxTask->xLastWakeTime + pxTask->xPeriod ) + pxTask->xDeadline;
+        prvNotifySchedulerEDF();
+    }
+#endif
+
+#if( configENABLE_BACKGROUND == 1 )
+    /* Queue a work drained by the Idle Task one chunk at a time: pdFALSE if a chunk is longer than the blocking
+     * accounted for the background (configBACKGROUND_MAX_CHUNK) or if there is no memory left */
+    BaseType_t xBackgroundWorkCreate( BackgroundChunkFunction_t pxChunkCode, const char *pcName, void *pvParameters,
+                                      UBaseType_t uxChunks, TickType_t xChunkWCET ){
+        cWork_t *pxWork;
+        if( xChunkWCET > configBACKGROUND_MAX_CHUNK ) return pdFALSE;
+
+        pxWork = pvPortMalloc( sizeof( cWork_t ) );
+        if( pxWork == NULL ) return pdFALSE;
+        pxWork->pxChunkCode = pxChunkCode;
+        pxWork->pcName = pcName;
+        pxWork->pvParameters = pvParameters;
+        pxWork->uxChunks = uxChunks;
+        pxWork->uxChunksDone = 0;
+        pxWork->xChunkWCET = xChunkWCET;
+        pxWork->xLongestChunk = 0;
+        pxWork->xBusyTicks = 0;
+        pxWork->xQueued = xTaskGetTickCount();
+        vListInitialiseItem( &pxWork->xWorkItem );
+        listSET_LIST_ITEM_OWNER( &pxWork->xWorkItem, pxWork );
+
+        // The Idle Task may be walking the queue
+        taskENTER_CRITICAL();
+        vListInsertEnd( &xBackground_List, &pxWork->xWorkItem );
+        taskEXIT_CRITICAL();
+        return pdTRUE;
+    }
+
+    /* Print the progress of the queued background works and the idle time recovered so far */
+    void vBackgroundWorkReport(){
+        cWork_t *pxWork;
+
+        // The Idle Task does not run a chunk meanwhile
+        vTaskSuspendAll();
+        printf("\n[BACKGROUND] Tick count %lu - Completed %lu - Chunks %lu - Idle ticks recovered %lu\n", xTaskGetTickCount(),
+               uxBackgroundCompleted, uxBackgroundChunks, xBackgroundTicks);
+        ListItem_t *pxWork_Pointer = listGET_HEAD_ENTRY( &xBackground_List );
+        const ListItem_t *pxWork_Tail = listGET_END_MARKER( &xBackground_List );
+        while( pxWork_Pointer != pxWork_Tail ){
+            pxWork = listGET_LIST_ITEM_OWNER( pxWork_Pointer );
+            if( pxWork->uxChunks > 0 )
+                printf("Work %s - Chunk %lu/%lu (%lu%%) - Busy ticks %lu - Longest chunk %lu\n", pxWork->pcName,
+                       pxWork->uxChunksDone, pxWork->uxChunks, pxWork->uxChunksDone * 100 / pxWork->uxChunks,
+                       pxWork->xBusyTicks, pxWork->xLongestChunk);
+            else printf("Work %s - Chunk %lu - Busy ticks %lu - Longest chunk %lu\n", pxWork->pcName,
+                        pxWork->uxChunksDone, pxWork->xBusyTicks, pxWork->xLongestChunk);
+            pxWork_Pointer = listGET_NEXT( pxWork_Pointer );
+        }
+        xTaskResumeAll();
+    }
+
+    /* Run one chunk of the next background work (round robin): the tasks preempt the Idle Task as usual, while the
+     * works only give way to each other and to the co-routines between two chunks, so a chunk must never block */
+    static void prvBackgroundRunChunk(){
+        cWork_t *pxWork;
+        TickType_t xStart, xElapsed;
+        BaseType_t xComplete;
+
+        taskENTER_CRITICAL();
+        if( listLIST_IS_EMPTY( &xBackground_List ) == pdTRUE ){
+            taskEXIT_CRITICAL();
+            return;
+        }
+        listGET_OWNER_OF_NEXT_ENTRY( pxWork, &xBackground_List );
+        taskEXIT_CRITICAL();
+
+        xStart = xTaskGetTickCount();
+        xComplete = pxWork->pxChunkCode( pxWork->pvParameters, pxWork->uxChunksDone );
+        xElapsed = xTaskGetTickCount() - xStart;
+
+        // Progress accounting
+        pxWork->uxChunksDone++;
+        pxWork->xBusyTicks += xElapsed;
+        if( xElapsed > pxWork->xLongestChunk )
+            pxWork->xLongestChunk = xElapsed;
+        uxBackgroundChunks++;
+        xBackgroundTicks += xElapsed;
+
+        if( xComplete == pdTRUE ){
+            taskENTER_CRITICAL();
+            uxListRemove( &pxWork->xWorkItem );
+            uxBackgroundCompleted++;
+            taskEXIT_CRITICAL();
+            printf("\n[BACKGROUND] Tick count %lu - Work %s completed - Chunks %lu - Busy ticks %lu - Longest chunk %lu - "
+                   "Turnaround %lu\n", xTaskGetTickCount(), pxWork->pcName, pxWork->uxChunksDone, pxWork->xBusyTicks,
+                   pxWork->xLongestChunk, xTaskGetTickCount() - pxWork->xQueued);
+            vPortFree( pxWork );
+        }
+    }
+#endif
+
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 )
+    /* Build the non-preemptive groups (Saksena-Wang): the highest priority task not grouped yet leads a new group,
+     * joined by every lower priority task whose threshold reaches the leader priority. One task is created per group */
+    static void prvCreateThresholdGroups(){
+        cTCB_t *pxTCB;
+        cTCB_t *pxMember;
+        cGroup_t *pxGroup;
+        UBaseType_t ulStackDepth = 0;
+        UBaseType_t ulSharedStackDepth = 0;
+        ListItem_t *pxMember_Pointer;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
         while( pxTCB_Pointer != pxTCB_Tail ){
             pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->uxGroup = configMAX_PRIORITIES;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
 
-            xR = xR + pxTCB->xWCET;
-            // Do the test until R is not equal to the deadline (in RMS the deadline is equal to the period)
-            while( xR <= pxTCB->xDeadline ){
-                xI = 0;
+        uxGroups = 0;
+        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->uxGroup == configMAX_PRIORITIES ){
+                pxGroup = &xGroups[ uxGroups ];
+                pxGroup->pxRunning = NULL;
+                pxGroup->xPriority = pxTCB->xPriority;
+                pxGroup->ulStackDepth = 0;
+                snprintf( pxGroup->cName, configMAX_TASK_NAME_LEN, "G%u", ( unsigned short ) uxGroups );
 
-                // Traverse the list and take the other task not equal to the task examined according to highest priority
-                ListItem_t *pxTCB_HigherPriorityItem = listGET_HEAD_ENTRY( pxTASK_List );
-                do{
-                    cTCB_t *pxTCB_HigherPriority = listGET_LIST_ITEM_OWNER( pxTCB_HigherPriorityItem );
-                    xI = xI + ( CEIL( xR, pxTCB_HigherPriority->xPeriod ) * pxTCB_HigherPriority->xWCET );
-                    pxTCB_HigherPriorityItem = listGET_NEXT( pxTCB_HigherPriorityItem );
-                }while( pxTCB_HigherPriorityItem != pxTCB_Pointer );
+                for( pxMember_Pointer = pxTCB_Pointer; pxMember_Pointer != pxTCB_Tail;
+                     pxMember_Pointer = listGET_NEXT( pxMember_Pointer ) ){
+                    pxMember = listGET_LIST_ITEM_OWNER( pxMember_Pointer );
+                    if( pxMember->uxGroup == configMAX_PRIORITIES && pxMember->xThreshold >= pxTCB->xPriority ){
+                        pxMember->uxGroup = uxGroups;
+                        if( pxMember->ulStackDepth > pxGroup->ulStackDepth )
+                            pxGroup->ulStackDepth = pxMember->ulStackDepth;
+                        ulStackDepth += pxMember->ulStackDepth;
+                        printf("Task %s - Group %s\n", pxMember->pcName, pxGroup->cName);
+                    }
+                }
+                ulSharedStackDepth += pxGroup->ulStackDepth;
+                uxGroups++;
+            }
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        printf("\n%lu groups - Stack %lu words (%lu without sharing)\n", uxGroups, ulSharedStackDepth, ulStackDepth);
 
-                xI = xI + pxTCB->xWCET;
+        for( pxGroup = xGroups; pxGroup < &xGroups[ uxGroups ]; pxGroup++ ){
+            xTaskCreate( prvThresholdGroupCode,
+                         pxGroup->cName,
+                         pxGroup->ulStackDepth,
+                         pxGroup,
+                         pxGroup->xPriority,
+                         &pxGroup->xHandle);
+        }
 
-                // If R is equal to I examine the next task
-                if( xR == xI )
-                    break;
-                else
-                    xR = xI;
-            }
+        // The handle of a periodic task is the one of its group
+        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            *pxTCB->pxTaskHandle = xGroups[ pxTCB->uxGroup ].xHandle;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+    }
 
-            if( xR > pxTCB->xDeadline )
-                return pdFALSE;
+    /* Return the highest priority member of the group with a pending job (NULL if none) */
+    static cTCB_t *prvGetPendingJobFromGroup( cGroup_t *pxGroup ){
+        cTCB_t *pxTCB;
+        UBaseType_t uxGroup = pxGroup - xGroups;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
-            // Update WCRT
-            pxTCB->xWCRT = xR;
-            printf("Task %s - WCET %lu - WCRT %lu\n", pxTCB->pcName, pxTCB->xWCET, pxTCB->xWCRT);
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            if( pxTCB->uxGroup == uxGroup && pxTCB->uxPendingJobs > 0 )
+                return pxTCB;
             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
         }
+        return NULL;
+    }
+
+    /* Return the TCB of the job executed by a group task (NULL if the handle is not a group task) */
+    static cTCB_t *prvGetTCBFromGroupByHandle( TaskHandle_t xTaskHandle ){
+        UBaseType_t uxGroup;
+
+        for( uxGroup = 0; uxGroup < uxGroups; uxGroup++ )
+            if( xGroups[ uxGroup ].xHandle == xTaskHandle )
+                return xGroups[ uxGroup ].pxRunning;
+        return NULL;
+    }
+
+    /* Group Task code: execute the pending jobs of the members, each one at its preemption threshold */
+    static void prvThresholdGroupCode( void *pvParameters ){
+        cGroup_t *pxGroup = pvParameters;
+        cTCB_t *pxTask;
+
+        for( ; ; ){
+            // The Release Task has given the group the priority of its highest priority pending job
+            taskENTER_CRITICAL();
+            pxTask = prvGetPendingJobFromGroup( pxGroup );
+            pxGroup->pxRunning = pxTask;
+            if( pxTask != NULL )
+                pxTask->xLastWakeTime = pxTask->xNextRelease - pxTask->uxPendingJobs * pxTask->xPeriod;
+            taskEXIT_CRITICAL();
+
+            if( pxTask == NULL ){
+                ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+                continue;
+            }
+
+            vTaskPrioritySet( NULL, pxTask->xThreshold );
+            if( xIdleFlag == 1){
+                printf("\n--------*[IDLE]*--------");
+                xIdleFlag=0;
+            }
+            printf("\n------------------------------------------------------------------------------");
+            prvJobEntry( pxTask );
+            printf( "\n[START] Tick count %lu - Task %s - LastWakeTime %lu - Priority %ld - Threshold %ld - Group %s\n",
+                    xTaskGetTickCount(), pxTask->pcName, pxTask->xLastWakeTime, pxTask->xPriority,
+                    pxTask->xThreshold, pxGroup->cName );
+            pxTask->pxTaskCode( pxTask->pvParameters );
+            printf( "\n[END] Execution time %lu (WCET: %lu) - Task %s\r\n", pxTask->xTimeSpent, pxTask->xWCET, pxTask->pcName );
+            prvJobExit( pxTask );
+
+            taskENTER_CRITICAL();
+            pxTask->uxPendingJobs--;
+            pxGroup->pxRunning = NULL;
+            taskEXIT_CRITICAL();
+
+            // Let the Release Task give back to the group the priority of the next pending job
+            xTaskNotifyGive( xReleaseHandle );
+        }
+    }
+
+    /* Release Task code: count the released jobs and set the priority of the groups not executing a job */
+    static void prvThresholdReleaseCode(){
+        cTCB_t *pxTCB;
+        TickType_t xNow;
+        TickType_t xWait;
+        UBaseType_t uxGroup;
+        ListItem_t *pxTCB_Pointer;
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        // The first releases follow the start of the scheduler, not the creation of the tasks
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xNextRelease = xStartTime + pxTCB->xArrivalTime;
+        }
+
+        for( ; ; ){
+            xNow = xTaskGetTickCount();
+            xWait = portMAX_DELAY;
+
+            // The release times are compared as offsets from xNow, across the tick wraparound
+            pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+            while( pxTCB_Pointer != pxTCB_Tail ){
+                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                while( ( TickType_t ) ( xNow - pxTCB->xNextRelease ) <= ( portMAX_DELAY >> 1 ) ){
+                    pxTCB->uxPendingJobs++;
+                    pxTCB->xNextRelease += pxTCB->xPeriod;
+                }
+                if( ( TickType_t ) ( pxTCB->xNextRelease - xNow ) < xWait )
+                    xWait = pxTCB->xNextRelease - xNow;
+                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+            }
+
+            // A group with no started job competes with the priority of its highest priority pending job
+            for( uxGroup = 0; uxGroup < uxGroups; uxGroup++ ){
+                if( xGroups[ uxGroup ].pxRunning == NULL ){
+                    pxTCB = prvGetPendingJobFromGroup( &xGroups[ uxGroup ] );
+                    if( pxTCB != NULL ){
+                        vTaskPrioritySet( xGroups[ uxGroup ].xHandle, pxTCB->xPriority );
+                        xTaskNotifyGive( xGroups[ uxGroup ].xHandle );
+                    }
+                }
+            }
+
+            // Wait for the next release or for the completion of a job
+            ulTaskNotifyTake( pdTRUE, xWait );
+        }
+    }
+#endif
+
+#if( configENABLE_BENCHMARK == 1 || configENABLE_PROFILING == 1 || configENABLE_OVERHEADS == 1 )
+    /* Return the cycles elapsed since the scheduler start, extending the tick count with the SysTick counter */
+    static uint32_t prvGetCycleCount(){
+        TickType_t xTicks;
+        uint32_t ulValue;
+
+        // Read again if a tick interrupt occurred in between the two readings
+        do{
+            xTicks = xTaskGetTickCount();
+            ulValue = benchSYSTICK_CURRENT_VALUE_REG;
+        }while( xTicks != xTaskGetTickCount() );
+
+        return ( uint32_t ) xTicks * ( benchSYSTICK_LOAD_REG + 1 ) + ( benchSYSTICK_LOAD_REG - ulValue );
+    }
+#endif
+
+#if( configENABLE_BENCHMARK == 1 )
+
+    /* Empty job used to fill the measured task set and the aperiodic queue */
+    static void prvBenchmarkDummyCode( void *pvParameters ){
+        (void) pvParameters;
+    }
+
+    /* Create a task set of uxTasks periodic tasks (U = 0.5) whose kernel tasks are kept suspended */
+    static void prvBenchmarkCreateTaskSet( UBaseType_t uxTasks ){
+        UBaseType_t uxTask;
+        TickType_t xPeriod;
+        TickType_t xWCET;
+
+        for( uxTask = 0; uxTask < uxTasks; uxTask++ ){
+            snprintf( cBenchTaskNames[ uxTask ], configMAX_TASK_NAME_LEN, "B%u", ( unsigned short ) uxTask );
+            xPeriod = pdMS_TO_TICKS( 500 ) + uxTask * 10;
+            xWCET = xPeriod / ( 2 * uxTasks );
+            if( xWCET == 0 )
+                xWCET = 1;
+            vPeriodicTaskCreate( prvBenchmarkDummyCode, cBenchTaskNames[ uxTask ], &xBenchTaskHandles[ uxTask ],
+                                 configBENCH_STACK_DEPTH, NULL, tskIDLE_PRIORITY + 1, 0, xPeriod, xPeriod, xWCET );
+        }
+
+        #if( configENABLE_RM == 1 )
+            #if( configENABLE_FIXED == 0)
+                prvAssignPriorityRMS();
+            #endif
+        #elif( configENABLE_POLICY_SELECT == 1 )
+            if( pxPolicy->pxAssignPriorities != NULL )
+                pxPolicy->pxAssignPriorities();
+        #elif( configENABLE_EDF == 1 )
+            prvSetEDF();
+        #endif
+
+        // The tasks never run: they are only needed by the kernel calls done by the library (e.g. vTaskPrioritySet)
+        vTaskSuspendAll();
+        prvCallTaskCreate();
+        for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+            vTaskSuspend( xBenchTaskHandles[ uxTask ] );
+        xTaskResumeAll();
+    }
+
+    /* Delete the measured task set and free its TCBs */
+    static void prvBenchmarkDeleteTaskSet(){
+        cTCB_t *pxTCB;
+
+        while( listLIST_IS_EMPTY( pxTASK_List ) == pdFALSE ){
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxTASK_List );
+            uxListRemove( &pxTCB->pxTCBItem );
+            vTaskDelete( *pxTCB->pxTaskHandle );
+            vPortFree( pxTCB );
+        }
+        // Let the Idle Task free the memory of the deleted tasks
+        vTaskDelay( pdMS_TO_TICKS( 10 ) );
+    }
+
+    /* Print min, average and max of the samples as a CSV record */
+    static void prvBenchmarkReport( const char *pcMetric, UBaseType_t uxTasks, const uint32_t *pulSamples ){
+        #if( configENABLE_POLICY_SELECT == 1 )
+            const char *pcPolicy = pxPolicy->pcName;
+        #elif( configENABLE_EDF == 1 )
+            const char *pcPolicy = "EDF";
+        #elif( configENABLE_FIXED == 1 )
+            const char *pcPolicy = "FIXED";
+        #else
+            const char *pcPolicy = "RM";
+        #endif
+        uint32_t ulMin = pulSamples[ 0 ];
+        uint32_t ulMax = pulSamples[ 0 ];
+        uint32_t ulSum = 0;
+        UBaseType_t uxRun;
+
+        for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+            if( pulSamples[ uxRun ] < ulMin )
+                ulMin = pulSamples[ uxRun ];
+            if( pulSamples[ uxRun ] > ulMax )
+                ulMax = pulSamples[ uxRun ];
+            ulSum += pulSamples[ uxRun ];
+        }
+
+        printf( "BENCH,%s,%s,%lu,%d,%lu,%lu,%lu\n", pcPolicy, pcMetric, uxTasks, configBENCH_RUNS,
+                ulMin, ulSum / configBENCH_RUNS, ulMax );
+    }
+
+    /* Sweep the task count and measure the cycles spent by the library functions */
+    static void prvBenchmarkSweep(){
+        uint32_t ulSamples[ configBENCH_RUNS ];
+        uint32_t ulStart;
+        UBaseType_t uxTasks;
+        UBaseType_t uxRun;
+        cTCB_t *pxTCB;
+
+        for( uxTasks = configBENCH_MIN_TASKS; uxTasks <= configBENCH_MAX_TASKS; uxTasks *= 2 ){
+            prvBenchmarkCreateTaskSet( uxTasks );
+
+            // Cost of the measurement itself, to be subtracted from the other metrics
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "cycle_counter", uxTasks, ulSamples );
+
+            // The Benchmark Task is not in the Task List: the hook walks the whole list as in the worst case
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                vApplicationTickHook();
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "tick_hook", uxTasks, ulSamples );
+
+            // Per-tick cost of the 64-bit time base, and of a reading from a task
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                prvTimeBaseTick();
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "time_base_tick", uxTasks, ulSamples );
+
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                ullGetTickCount64();
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "time_base_read", uxTasks, ulSamples );
+
+            // Job entry and exit of the task with the lowest priority
+            pxTCB = listGET_LIST_ITEM_OWNER( listGET_END_MARKER( pxTASK_List )->pxPrevious );
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                prvJobEntry( pxTCB );
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "job_entry", uxTasks, ulSamples );
+
+            for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                ulStart = prvGetCycleCount();
+                prvJobExit( pxTCB );
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
+            prvBenchmarkReport( "job_exit", uxTasks, ulSamples );
+
+            #if( configENABLE_EDF == 1 )
+                #if( configENABLE_POLICY_SELECT == 1 )
+                    // The static policies never sort the Task List again
+                    if( pxPolicy->xDynamic == pdTRUE )
+                #endif
+                {
+                    for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                        ulStart = prvGetCycleCount();
+                        prvCheckPrioritiesEDF();
+                        ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                    }
+                    prvBenchmarkReport( "edf_resort", uxTasks, ulSamples );
+                }
+            #endif
+
+            #if( (configENABLE_RM == 1 || configENABLE_EDF == 1) && configENABLE_FIXED == 0 )
+                for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                    ulStart = prvGetCycleCount();
+                    prvCheckFeasibilitySTD();
+                    ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                }
+                prvBenchmarkReport( "feasibility_std", uxTasks, ulSamples );
+
+                for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                    ulStart = prvGetCycleCount();
+                    prvCheckFeasibilityWCRT( pxTASK_List, pdFALSE );
+                    ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                }
+                prvBenchmarkReport( "feasibility_wcrt", uxTasks, ulSamples );
+            #endif
+
+            #if( configENABLE_SLACK_STEALING == 1 )
+                for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                    ulStart = prvGetCycleCount();
+                    prvGetAvailableSlack();
+                    ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                }
+                prvBenchmarkReport( "ss_slack", uxTasks, ulSamples );
+            #elif( configENABLE_APERIODIC == 1 )
+            {
+                cTCB_t xPollingServer;
+                cTCBA_t *pxTCBA;
+                xPollingServer.xBudgetPS = portMAX_DELAY;
 
-        return pdTRUE;
-    }
-#endif
+                // Keep uxTasks aperiodic tasks queued while measuring a release and a dispatch
+                for( uxRun = 0; uxRun < uxTasks; uxRun++ )
+                    vAperiodicTaskCreate( prvBenchmarkDummyCode, "BenchAP", NULL, 1 );
 
-/* Wrapper function calling all Task Code functions to execute them*/
-static void prvPeriodicTaskMaster( void *pvParameters ){
-    TaskHandle_t xCurrentTaskHandle = xTaskGetCurrentTaskHandle();
-    #if( configENABLE_RM == 1 )
-        cTCB_t *pxTask = prvGetTCBFromListByHandleRMS(xCurrentTaskHandle);
-    #elif( configENABLE_EDF == 1 )
-        cTCB_t *pxTask = prvGetTCBFromListByHandleEDF(xCurrentTaskHandle);
-    #endif
+                for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                    ulStart = prvGetCycleCount();
+                    vAperiodicTaskCreate( prvBenchmarkDummyCode, "BenchAP", NULL, 1 );
+                    ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                }
+                prvBenchmarkReport( "ps_release", uxTasks, ulSamples );
 
-    if ( pxTask->xArrivalTime != 0 )
-        vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xArrivalTime );
-    if ( pxTask->xArrivalTime == 0 )
-        pxTask->xLastWakeTime = xStartTime;
+                for( uxRun = 0; uxRun < configBENCH_RUNS; uxRun++ ){
+                    ulStart = prvGetCycleCount();
+                    pxTCBA = prvPollingServerDispatch( &xPollingServer );
+                    ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+                    vPortFree( pxTCBA );
+                }
+                prvBenchmarkReport( "ps_dispatch", uxTasks, ulSamples );
 
-    for ( ; ; )
-    {
-        TickType_t xStartTick = xTaskGetTickCount();
-        if( xIdleFlag == 1){
-            printf("\n--------*[IDLE]*--------");
-            xIdleFlag=0;
+                while( listLIST_IS_EMPTY( pxAperiodicTASK_List ) == pdFALSE )
+                    vPortFree( prvPollingServerDispatch( &xPollingServer ) );
+            }
+            #endif
+
+            prvBenchmarkDeleteTaskSet();
         }
-        printf("\n------------------------------------------------------------------------------");
-        #if( configENABLE_EDF == 1)
-            prvNotifySchedulerEDF();
-            printf( "\nTick Count %lu Task %s lastWakeTime %lu Abs deadline %lu Priority %ld\n",
-                    xStartTick, pxTask->pcName, pxTask->xLastWakeTime,  pxTask->xAbsDeadline, pxTask->xPriority);
-        #endif
-        pxTask->xTaskJobStatus = pdFALSE;
-        #if( configENABLE_RM == 1 )
-            printf( "\n[START] Tick count %lu - Task %s - LastWakeTime %lu - Priority %ld \n", xStartTick, pxTask->pcName,
-                    pxTask->xLastWakeTime, pxTask->xPriority );
-        #endif
-        pxTask->pxTaskCode( pvParameters );
-        pxTask->xTaskJobStatus = pdTRUE;
-        printf( "\n[END] Execution time %lu (WCET: %lu) - Task %s\r\n", pxTask->xTimeSpent, pxTask->xWCET, pxTask->pcName );
-        pxTask->xTimeSpent = 0;
+    }
 
-        #if( configENABLE_EDF == 1 )
-            pxTask->xAbsDeadline = pxTask->xDeadline + pxTask->xLastWakeTime + pxTask->xPeriod;
-            // Notify scheduler that the task has been executed and update priorities
-            prvNotifySchedulerEDF();
+    /* Benchmark Task code: one sweep of the algorithm enabled above, or of every policy selectable at runtime */
+    static void prvBenchmarkCode( void *pvParameters ){
+        (void) pvParameters;
+
+        printf( "\nBENCH,policy,metric,tasks,runs,min_cycles,avg_cycles,max_cycles\n" );
+
+        #if( configENABLE_POLICY_SELECT == 1 )
+            const cPolicy_t *pxSelected = pxPolicy;
+            // Same binary and same task sets for every policy
+            for( pxPolicy = xPolicies; pxPolicy <= &xPolicies[ POLICY_EDF ]; pxPolicy++ )
+                prvBenchmarkSweep();
+            pxPolicy = pxSelected;
+        #else
+            prvBenchmarkSweep();
         #endif
 
-        vTaskDelayUntil( &pxTask->xLastWakeTime, pxTask->xPeriod );
+        printf( "\nBENCHMARK COMPLETED\n" );
+        vTaskDelete( NULL );
+    }
+#endif
 
+#if( configENABLE_GENERATOR == 1 )
+    /* Uniform random number in [0, 1) from a xorshift generator (reproducible with the same seed) */
+    static float prvGenUniform(){
+        ulGenSeed ^= ulGenSeed << 13;
+        ulGenSeed ^= ulGenSeed >> 17;
+        ulGenSeed ^= ulGenSeed << 5;
+        return ( float ) ( ulGenSeed >> 8 ) / 16777216.0f;
     }
-}
 
-/* Create all tasks traversing the Task List*/
-static void prvCallTaskCreate(){
-    cTCB_t *pxTCB;
+    /* UUniFast-Discard: split the total utilisation xU among the tasks, pdFALSE if a task exceeds 1 */
+    static BaseType_t prvGenUUniFast( float xU, float *pxU ){
+        float xSum = xU;
+        float xNextSum;
+        UBaseType_t uxTask;
 
-    ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-    const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        for( uxTask = 0; uxTask < configGEN_TASKS - 1; uxTask++ ){
+            xNextSum = xSum * powf( prvGenUniform(), 1.0f / ( configGEN_TASKS - 1 - uxTask ) );
+            pxU[ uxTask ] = xSum - xNextSum;
+            xSum = xNextSum;
+        }
+        pxU[ configGEN_TASKS - 1 ] = xSum;
 
-    while( pxTCB_Pointer != pxTCB_Tail ){
-        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-        xTaskCreate( prvPeriodicTaskMaster,
-                     pxTCB->pcName,
-                     pxTCB->ulStackDepth,
-                     pxTCB->pvParameters,
-                     pxTCB->xPriority,
-                     pxTCB->pxTaskHandle);
-        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        for( uxTask = 0; uxTask < configGEN_TASKS; uxTask++ )
+            if( pxU[ uxTask ] > 1.0f )
+                return pdFALSE;
+        return pdTRUE;
     }
-}
-/**
- * ---------------------------------------------------------------------------------
- */
 
-/**
- * ---------------------------------------------------------------------------------
- * Functions by Category
- */
+    /* Random period in [configGEN_T_MIN, configGEN_T_MAX], log-uniform or harmonic (T_MIN * 2^k) */
+    static TickType_t prvGenPeriod( BaseType_t xHarmonic ){
+        TickType_t xPeriod;
+        UBaseType_t uxOctaves = 0;
 
-#if( configENABLE_RM == 1 )
-    /* Initialize TCB Item and insert it in Task List */
-    static void prvInitialiseTCBItemRMS( cTCB_t *pxTCB ) {
-        /* Initialize container to null so the item
-         * does not think that it is already contained in a list*/
-        vListInitialiseItem( &pxTCB->pxTCBItem );
-        // The owner of a list item is the object (usually a TCB) that contains the list item
-        listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
-        // The list is sorted in ascending order by period value
-        listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xPeriod);
+        if( xHarmonic == pdTRUE ){
+            for( xPeriod = configGEN_T_MIN; xPeriod * 2 <= configGEN_T_MAX; xPeriod *= 2 )
+                uxOctaves++;
+            return configGEN_T_MIN << ( UBaseType_t ) ( prvGenUniform() * ( uxOctaves + 1 ) );
+        }
 
-        // Insert Item in Task List
-        vListInsert( pxTASK_List, &pxTCB->pxTCBItem );
+        return ( TickType_t ) expf( logf( configGEN_T_MIN ) +
+                                    prvGenUniform() * ( logf( configGEN_T_MAX ) - logf( configGEN_T_MIN ) ) );
     }
 
-    /* Return TCB from the Task List by Task Handle */
-    static cTCB_t *prvGetTCBFromListByHandleRMS(TaskHandle_t xTaskHandle){
+    /* Fill the generated Task List with a task set of total utilisation xU */
+    static BaseType_t prvGenTaskSet( float xU, BaseType_t xHarmonic ){
+        float xTaskU[ configGEN_TASKS ];
+        float xRatio;
+        UBaseType_t uxTask;
         cTCB_t *pxTCB;
-        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
-        while( pxTCB_Pointer != pxTCB_Tail ){
-            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-            if ( strcmp(pxTCB->pcName, pcTaskGetName(xTaskHandle)) == 0 )
-                return pxTCB;
-            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        while( prvGenUUniFast( xU, xTaskU ) == pdFALSE );
+
+        vListInitialise( &xGenTASK_List );
+        for( uxTask = 0; uxTask < configGEN_TASKS; uxTask++ ){
+            pxTCB = &xGenTCBs[ uxTask ];
+            pxTCB->pcName = "Gen";
+            pxTCB->xPeriod = prvGenPeriod( xHarmonic );
+            pxTCB->xWCET = ( TickType_t ) ( xTaskU[ uxTask ] * pxTCB->xPeriod + 0.5f );
+            if( pxTCB->xWCET == 0 )
+                pxTCB->xWCET = 1;
+            xRatio = ( configGEN_DT_MIN + prvGenUniform() * ( configGEN_DT_MAX - configGEN_DT_MIN ) ) / 100.0f;
+            pxTCB->xDeadline = ( TickType_t ) ( xRatio * pxTCB->xPeriod );
+            if( pxTCB->xDeadline < pxTCB->xWCET )
+                pxTCB->xDeadline = pxTCB->xWCET;
+            pxTCB->xWCRT = pxTCB->xWCET;
+
+            vListInitialiseItem( &pxTCB->pxTCBItem );
+            listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
+            listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xPeriod );
+            vListInsert( &xGenTASK_List, &pxTCB->pxTCBItem );
         }
-        return NULL;
+        return pdTRUE;
     }
 
-    #if(configENABLE_FIXED == 0)
-        /* Assign a priori Task's priority traversing the Sorted List */
-        static void prvAssignPriorityRMS() {
-            cTCB_t *pxTCB;
-            // Set priority of tasks starting by the max task priority - 1
-            UBaseType_t xHighestPriority = configMAX_PRIORITIES - 1;
+    /* Run every feasibility test over random task sets and print the number of accepted sets per utilisation */
+    void vRunSchedulabilityBenchmark(){
+        const char *pcPeriods[] = { "log-uniform", "harmonic" };
+        BaseType_t xHarmonic;
+        UBaseType_t uxU;
+        UBaseType_t uxSet;
+        UBaseType_t uxHyperbolic;
+        UBaseType_t uxWCRT;
+        UBaseType_t uxUtilisation;
+        UBaseType_t uxDemand;
 
-            ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-            const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        printf( "\nSCHED,periods,utilisation,sets,hyperbolic,wcrt,edf_utilisation,edf_demand\n" );
 
-            while( pxTCB_Pointer != pxTCB_Tail ){
-                pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-                // Set the priority from higher to lower since the list is sorted by ascending periods
-                pxTCB->xPriority = xHighestPriority;
-                xHighestPriority--;
+        for( xHarmonic = pdFALSE; xHarmonic <= pdTRUE; xHarmonic++ ){
+            for( uxU = configGEN_U_MIN; uxU <= configGEN_U_MAX; uxU += configGEN_U_STEP ){
+                uxHyperbolic = 0;
+                uxWCRT = 0;
+                uxUtilisation = 0;
+                uxDemand = 0;
 
-                pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                for( uxSet = 0; uxSet < configGEN_SETS; uxSet++ ){
+                    prvGenTaskSet( uxU / 100.0f, xHarmonic );
+                    uxHyperbolic += prvCheckHyperbolicBound( &xGenTASK_List );
+                    uxWCRT += prvCheckFeasibilityWCRT( &xGenTASK_List, pdFALSE );
+                    uxUtilisation += prvCheckUtilisationBound( &xGenTASK_List );
+                    uxDemand += prvCheckProcessorDemandEDF( &xGenTASK_List );
+                }
+
+                printf( "SCHED,%s,%lu,%d,%lu,%lu,%lu,%lu\n", pcPeriods[ xHarmonic ], uxU, configGEN_SETS,
+                        uxHyperbolic, uxWCRT, uxUtilisation, uxDemand );
             }
         }
-    #endif
-#endif
-
-#if( configENABLE_EDF == 1 )
-    /* Assign priority traversing the Sorted List */
-    static void prvSetEDF(){
-        cTCB_t *pxTCB;
-        // Set priority of tasks starting by the scheduler priority - 1
-        UBaseType_t xHighestPriority = configSCHED_PRIO - 1;
 
-        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+        printf( "\nSCHEDULABILITY BENCHMARK COMPLETED\n" );
+    }
+#endif
 
-        while( pxTCB_Pointer != pxTCB_Tail ){
-            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-            // Set the priority from higher to lower since the list is sorted by ascending deadlines
-            pxTCB->xPriority = xHighestPriority;
-            xHighestPriority--;
+#if( configENABLE_PROFILING == 1 )
+    /* Fit a Gumbel distribution to the maxima of the blocks of configPROF_BLOCK samples (method of moments) */
+    static void prvProfilingFitGumbel( const uint32_t *pulSamples, float *pxMu, float *pxBeta ){
+        float xMaxima[ configPROF_RUNS / configPROF_BLOCK ];
+        float xMean = 0.0f;
+        float xVariance = 0.0f;
+        UBaseType_t uxBlocks = configPROF_RUNS / configPROF_BLOCK;
+        UBaseType_t uxBlock;
+        UBaseType_t uxRun;
 
-            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        for( uxBlock = 0; uxBlock < uxBlocks; uxBlock++ ){
+            xMaxima[ uxBlock ] = 0.0f;
+            for( uxRun = uxBlock * configPROF_BLOCK; uxRun < ( uxBlock + 1 ) * configPROF_BLOCK; uxRun++ )
+                if( pulSamples[ uxRun ] > xMaxima[ uxBlock ] )
+                    xMaxima[ uxBlock ] = pulSamples[ uxRun ];
+            xMean += xMaxima[ uxBlock ];
         }
+        xMean /= uxBlocks;
+        for( uxBlock = 0; uxBlock < uxBlocks; uxBlock++ )
+            xVariance += ( xMaxima[ uxBlock ] - xMean ) * ( xMaxima[ uxBlock ] - xMean );
+        xVariance /= ( uxBlocks - 1 );
+
+        // Standard deviation = beta * pi / sqrt(6), mean = mu + beta * Euler-Mascheroni constant
+        *pxBeta = sqrtf( 6.0f * xVariance ) / 3.14159265f;
+        *pxMu = xMean - 0.57721566f * *pxBeta;
     }
 
-    /* Swap lists */
-    static void prvSwap( List_t **ppxList1, List_t **ppxList2 ){
-		List_t *pxList_tmp;
-			pxList_tmp = *ppxList1;
-			*ppxList1 = *ppxList2;
-			*ppxList2 = pxList_tmp;
+    /* pWCET in cycles exceeded by a single run with probability 1e-uxExceedance (never below the high-watermark) */
+    static uint32_t prvProfilingGetPWCET( float xMu, float xBeta, UBaseType_t uxExceedance, uint32_t ulHWM ){
+        // Probability that the maximum of a block exceeds the pWCET
+        float xBlockExceedance = configPROF_BLOCK * powf( 10.0f, -( float ) uxExceedance );
+        float xPWCET = xMu - xBeta * logf( -log1pf( -xBlockExceedance ) );
+
+        if( xPWCET < ulHWM )
+            return ulHWM;
+        return ( uint32_t ) ( xPWCET + 0.5f );
     }
 
-    /* Assign new priorities to tasks based on their new absolute deadlines */
-    static void prvCheckPrioritiesEDF(){
+    /* Profiling Task code: run the code of every periodic task configPROF_RUNS times, print the measured and
+     * the probabilistic WCETs and the task-set header with the suggested budgets */
+    static void prvProfilingCode( void *pvParameters ){
+        (void) pvParameters;
+        uint32_t ulSamples[ configPROF_RUNS ];
+        uint32_t ulStart;
+        uint32_t ulMin;
+        uint32_t ulHWM;
+        uint32_t ulSum;
+        uint32_t ulCyclesPerTick = benchSYSTICK_LOAD_REG + 1;
+        float xMu;
+        float xBeta;
+        UBaseType_t uxRun;
+        UBaseType_t uxExceedance;
         cTCB_t *pxTCB;
         ListItem_t *pxTCB_Pointer;
-        ListItem_t *pxTCB_Pointer_tmp;
-
-        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
         const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
-        while( pxTCB_Pointer != pxTCB_Tail ){
+
+        printf( "\nPROF,task,runs,min_cycles,avg_cycles,hwm_cycles,gumbel_mu,gumbel_beta\n" );
+        printf( "PWCET,task,exceedance,pwcet_cycles,pwcet_ticks,wcet_ticks\n" );
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
             pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            for( uxRun = 0; uxRun < configPROF_RUNS; uxRun++ ){
+                // Every run starts right after a tick, with no other task ready
+                vTaskDelay( 1 );
+                ulStart = prvGetCycleCount();
+                pxTCB->pxTaskCode( pxTCB->pvParameters );
+                ulSamples[ uxRun ] = prvGetCycleCount() - ulStart;
+            }
 
-            // Sort again the list by the new task's deadlnine (updated absolute deadline)
-            listSET_LIST_ITEM_VALUE( pxTCB_Pointer , pxTCB->xAbsDeadline );
+            ulMin = ulSamples[ 0 ];
+            ulHWM = ulSamples[ 0 ];
+            ulSum = 0;
+            for( uxRun = 0; uxRun < configPROF_RUNS; uxRun++ ){
+                if( ulSamples[ uxRun ] < ulMin )
+                    ulMin = ulSamples[ uxRun ];
+                if( ulSamples[ uxRun ] > ulHWM )
+                    ulHWM = ulSamples[ uxRun ];
+                ulSum += ulSamples[ uxRun ];
+            }
+            prvProfilingFitGumbel( ulSamples, &xMu, &xBeta );
+            pxTCB->xWCETProfiled = CEIL( prvProfilingGetPWCET( xMu, xBeta, configPROF_EXCEEDANCE, ulHWM ), ulCyclesPerTick );
 
-            // Update list removing the previous on temp list and swapping
-            pxTCB_Pointer_tmp = pxTCB_Pointer;
-            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
-            uxListRemove( pxTCB_Pointer->pxPrevious );
+            // The task code may not end its output with a new line
+            printf( "\nPROF,%s,%d,%lu,%lu,%lu,%lu,%lu\n", pxTCB->pcName, configPROF_RUNS, ulMin, ulSum / configPROF_RUNS,
+                    ulHWM, ( uint32_t ) xMu, ( uint32_t ) xBeta );
+            for( uxExceedance = 3; uxExceedance <= configPROF_EXCEEDANCE_MAX; uxExceedance += 3 ){
+                ulStart = prvProfilingGetPWCET( xMu, xBeta, uxExceedance, ulHWM );
+                printf( "PWCET,%s,1e-%lu,%lu,%lu,%lu\n", pxTCB->pcName, uxExceedance, ulStart,
+                        CEIL( ulStart, ulCyclesPerTick ), pxTCB->xWCET );
+            }
+        }
 
-            vListInsert( pxTASK_List_tmp, pxTCB_Pointer_tmp );
+        // Task-set header with the suggested WCETs, to be extracted from the output with: grep '^WCET,' | cut -c6-
+        printf( "\nWCET,/* Generated by the WCET profiling: pWCET exceeded with probability 1e-%d per job */\n",
+                configPROF_EXCEEDANCE );
+        printf( "WCET,#ifndef TASKSETWCET_H\nWCET,#define TASKSETWCET_H\n" );
+        for( pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List ); pxTCB_Pointer != pxTCB_Tail;
+             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer ) ){
+            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            printf( "WCET,#define profWCET_%s %lu    // ticks (current budget %lu)\n", pxTCB->pcName, pxTCB->xWCETProfiled,
+                    pxTCB->xWCET );
         }
+        printf( "WCET,#endif\n" );
 
-        prvSwap( &pxTASK_List, &pxTASK_List_tmp);
-        // Update highest priority
-        BaseType_t xHighestPriority = configSCHED_PRIO - 1;
+        printf( "\nPROFILING COMPLETED\n" );
+        vTaskDelete( NULL );
+    }
+#endif
 
-        pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+#if( configENABLE_MULTICORE == 1 )
+    /* Sorting key of a task: its utilisation C/T, or its density C/min(D,T) */
+    static float prvMulticoreGetKey( cTCB_t *pxTCB, BaseType_t xDensity ){
+        TickType_t xWindow = pxTCB->xPeriod;
+        if( xDensity == pdTRUE && pxTCB->xDeadline < xWindow )
+            xWindow = pxTCB->xDeadline;
+        return (float) pxTCB->xWCET / xWindow;
+    }
 
-        while( pxTCB_Pointer != pxTCB_Tail ){
-            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-            pxTCB->xPriority = xHighestPriority;
-            // Set the new updated priority to the target task
-            vTaskPrioritySet( *pxTCB->pxTaskHandle, pxTCB->xPriority );
+    /* Sum of the sorting keys of the tasks assigned to a core */
+    static float prvMulticoreGetLoad( List_t *pxCore, BaseType_t xDensity ){
+        float xLoad = 0.0;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxCore );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxCore );
 
-            xHighestPriority--;
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            xLoad += prvMulticoreGetKey( listGET_LIST_ITEM_OWNER( pxTCB_Pointer ), xDensity );
             pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
         }
+        return xLoad;
     }
 
-    /* EDF Scheduler function code */
-    static void prvSchedulerEDFCode(){
-        for( ; ; ){
-            prvCheckPrioritiesEDF();
-            // Unblock target task
-            ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
-        }
-    }
+    /* Exact test of a core with the task added: WCRT test (RMS) or Processor Demand Criterion (EDF) */
+    static BaseType_t prvMulticoreFits( cTCB_t *pxTCB, List_t *pxCore ){
+        BaseType_t xFits;
 
-    /* Create EDF Scheduler Task */
-    static void prvSchedulerEDFCreate(){
-        xTaskCreate( prvSchedulerEDFCode,
-                     "SchedulerEDF",
-                     configSCHED_MAX_STACK_DEPTH,
-                     NULL,
-                     configSCHED_PRIO,
-                     &xSchedulerEDFHandle);
+        vListInsert( pxCore, &pxTCB->pxTCBItem );
+        #if( configENABLE_EDF == 1 )
+            xFits = prvCheckProcessorDemandEDF( pxCore );
+        #else
+            xFits = prvCheckFeasibilityWCRT( pxCore, pdFALSE );
+        #endif
+        uxListRemove( &pxTCB->pxTCBItem );
+        return xFits;
     }
 
-    /* Return TCB from the Task List by Task Handle */
-    static cTCB_t *prvGetTCBFromListByHandleEDF(TaskHandle_t xTaskHandle){
+    /* Assign the tasks by decreasing key to the first core that fits (uxFit 0), to the most loaded one (1, best-fit) or to
+     * the least loaded one (2, worst-fit). With xOnDemand a core is opened only when no opened one fits, otherwise all the
+     * uxCores cores are available from the start. Return the number of cores used, 0 if a task fits nowhere */
+    static UBaseType_t prvMulticoreAssign( UBaseType_t uxTasks, UBaseType_t uxFit, BaseType_t xDensity, UBaseType_t uxCores,
+                                           BaseType_t xOnDemand ){
+        UBaseType_t uxOrder[ configMULTICORE_MAX_TASKS ];
+        UBaseType_t uxUsed = 0;
+        UBaseType_t uxCandidates;
+        UBaseType_t uxChosen;
+        UBaseType_t uxTask;
+        UBaseType_t uxCore;
+        UBaseType_t uxPos;
+        float xLoad;
+        float xChosenLoad = 0.0;
         cTCB_t *pxTCB;
-        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
-        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
 
-        while( pxTCB_Pointer != pxTCB_Tail ){
-            pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
-            if ( strcmp(pxTCB->pcName, pcTaskGetName(xTaskHandle)) == 0 )
-                return pxTCB;
-            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        // Decreasing key (insertion sort, ties in creation order)
+        for( uxTask = 0; uxTask < uxTasks; uxTask++ ){
+            for( uxPos = uxTask; uxPos > 0 && prvMulticoreGetKey( &xCoreTCBs[ uxOrder[ uxPos - 1 ] ], xDensity ) <
+                                                prvMulticoreGetKey( &xCoreTCBs[ uxTask ], xDensity ); uxPos-- )
+                uxOrder[ uxPos ] = uxOrder[ uxPos - 1 ];
+            uxOrder[ uxPos ] = uxTask;
         }
-        return NULL;
-    }
+        for( uxCore = 0; uxCore < configMULTICORE_MAX_CORES; uxCore++ )
+            vListInitialise( &xCore_Lists[ uxCore ] );
 
-    /* Initialize TCB Item and insert it in Task List */
-    static void prvInitialiseTCBItemEDF( cTCB_t *pxTCB ){
-        vListInitialiseItem( &pxTCB->pxTCBItem );
-        // The owner of a list item is the object (usually a TCB) that contains the list item
-        listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
-        // The list is sorted in ascending order by deadline value
-        listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xAbsDeadline);
+        for( uxTask = 0; uxTask < uxTasks; uxTask++ ){
+            pxTCB = &xCoreTCBs[ uxOrder[ uxTask ] ];
+            uxChosen = uxCores;
+            uxCandidates = ( xOnDemand == pdTRUE ) ? uxUsed : uxCores;
 
-        // Insert in global list
-        vListInsert( pxTASK_List, &pxTCB->pxTCBItem );
-    }
+            for( uxCore = 0; uxCore < uxCandidates; uxCore++ ){
+                if( prvMulticoreFits( pxTCB, &xCore_Lists[ uxCore ] ) == pdFALSE )
+                    continue;
+                xLoad = prvMulticoreGetLoad( &xCore_Lists[ uxCore ], xDensity );
+                if( uxChosen == uxCores || ( uxFit == 1 && xLoad > xChosenLoad ) || ( uxFit == 2 && xLoad < xChosenLoad ) ){
+                    uxChosen = uxCore;
+                    xChosenLoad = xLoad;
+                }
+                if( uxFit == 0 )
+                    break;
+            }
+            if( uxChosen == uxCores && xOnDemand == pdTRUE && uxUsed < uxCores &&
+                prvMulticoreFits( pxTCB, &xCore_Lists[ uxUsed ] ) == pdTRUE )
+                uxChosen = uxUsed;
+            if( uxChosen == uxCores )
+                return 0;
 
-    /* Call the EDF Scheduler Task */
-    static void prvNotifySchedulerEDF(){
-        BaseType_t xHigherPriorityTaskWoken;
-        // Notify the scheduler task to execute again since an ISR has been activated during context witching to here
-        vTaskNotifyGiveFromISR( xSchedulerEDFHandle, &xHigherPriorityTaskWoken );
-        // Request a context switch to the higher priority task returned by the scheduler
-        portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+            vListInsert( &xCore_Lists[ uxChosen ], &pxTCB->pxTCBItem );
+            if( uxChosen + 1 > uxUsed )
+                uxUsed = uxChosen + 1;
+        }
+        return uxUsed;
     }
-#endif
 
+    /* Simulate the schedule of a core from a synchronous release (the worst case with D <= T under RMS and EDF) up to the
+     * hyperperiod plus the longest deadline, or configMULTICORE_SIM_HORIZON. pdFALSE at the first deadline miss, pdTRUE
+     * otherwise with *pxTruncated set if the horizon cut the hyperperiod short (no miss found, but no proof either) */
+    static BaseType_t prvMulticoreSimulate( List_t *pxCore, TickType_t *pxHorizon, BaseType_t *pxTruncated ){
+        cTCB_t *pxTasks[ configMULTICORE_MAX_TASKS ];
+        TickType_t xRemaining[ configMULTICORE_MAX_TASKS ];
+        TickType_t xRelease[ configMULTICORE_MAX_TASKS ];
+        TickType_t xAbsDeadline[ configMULTICORE_MAX_TASKS ];
+        TickType_t xMaxDeadline = 0;
+        TickType_t xT;
+        uint64_t ullHyperperiod = 1;
+        uint64_t ullA;
+        uint64_t ullB;
+        uint64_t ullR;
+        UBaseType_t uxTasks = 0;
+        UBaseType_t uxTask;
+        UBaseType_t uxRunning;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxCore );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxCore );
 
-#if( configENABLE_APERIODIC == 1 )
-    /* Initialize TCB Item and insert it in Aperiodic Task List */
-    static void prvInitialiseTCBAItem( cTCBA_t *pxTCBA ){
-        vListInitialiseItem( &pxTCBA->pxTCBAItem );
-        // The owner of a list item is the object (usually a TCB) that contains the list item
-        listSET_LIST_ITEM_OWNER( &pxTCBA->pxTCBAItem, pxTCBA );
-        // The list is sorted in ascending order by arrival time (FIFO)
-        listSET_LIST_ITEM_VALUE( &pxTCBA->pxTCBAItem, pxTCBA->xArrival);
+        *pxTruncated = pdFALSE;
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            pxTasks[ uxTasks ] = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            xRemaining[ uxTasks ] = 0;
+            xRelease[ uxTasks ] = 0;
+            xAbsDeadline[ uxTasks ] = 0;
+            // Least common multiple of the periods, not needed beyond the horizon
+            for( ullA = ullHyperperiod, ullB = pxTasks[ uxTasks ]->xPeriod; ullB != 0; ullA = ullB, ullB = ullR )
+                ullR = ullA % ullB;
+            ullHyperperiod = ullHyperperiod / ullA * pxTasks[ uxTasks ]->xPeriod;
+            if( ullHyperperiod > configMULTICORE_SIM_HORIZON ){
+                ullHyperperiod = configMULTICORE_SIM_HORIZON;
+                *pxTruncated = pdTRUE;
+            }
+            if( pxTasks[ uxTasks ]->xDeadline > xMaxDeadline )
+                xMaxDeadline = pxTasks[ uxTasks ]->xDeadline;
+            uxTasks++;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        *pxHorizon = ( TickType_t ) ullHyperperiod + xMaxDeadline;
+        if( *pxHorizon > configMULTICORE_SIM_HORIZON ){
+            *pxHorizon = configMULTICORE_SIM_HORIZON;
+            *pxTruncated = pdTRUE;
+        }
 
-        // Insert in Aperiodic FIFO queue
-        vListInsert( pxAperiodicTASK_List, &pxTCBA->pxTCBAItem );
+        for( xT = 0; xT <= *pxHorizon; xT++ ){
+            uxRunning = uxTasks;
+            for( uxTask = 0; uxTask < uxTasks; uxTask++ ){
+                if( xRemaining[ uxTask ] > 0 && xT >= xAbsDeadline[ uxTask ] )
+                    return pdFALSE;
+                if( xT == xRelease[ uxTask ] ){
+                    xRemaining[ uxTask ] = pxTasks[ uxTask ]->xWCET;
+                    xAbsDeadline[ uxTask ] = xT + pxTasks[ uxTask ]->xDeadline;
+                    xRelease[ uxTask ] += pxTasks[ uxTask ]->xPeriod;
+                }
+                #if( configENABLE_EDF == 1 )
+                    if( xRemaining[ uxTask ] > 0 && ( uxRunning == uxTasks ||
+                                                      xAbsDeadline[ uxTask ] < xAbsDeadline[ uxRunning ] ) )
+                #else
+                    // The list is sorted by period: the first ready task has the RMS priority
+                    if( xRemaining[ uxTask ] > 0 && uxRunning == uxTasks )
+                #endif
+                        uxRunning = uxTask;
+            }
+            if( uxRunning < uxTasks )
+                xRemaining[ uxRunning ]--;
+        }
+        return pdTRUE;
     }
 
-    /* Polling Server Code function that tries to execute Aperiodic Tasks */
-    static void prvPollingServerCode(){
-        for( ; ; ){
-            if( pxAperiodicTASK_List->uxNumberOfItems == 0 ){
-                printf("[PS] No Aperiodic Tasks to Serve\n");
+    /* Assign the periodic tasks created so far to uxCores cores with every bin-packing heuristic, validate each core by
+     * simulation and print the smallest number of cores found */
+    void vRunMulticoreAssignment( UBaseType_t uxCores ){
+        const char *pcFits[] = { "first-fit", "best-fit", "worst-fit" };
+        const char *pcKeys[] = { "utilisation", "density" };
+        const char *pcBestFit = NULL;
+        const char *pcBestKey = NULL;
+        float xU = 0.0;
+        TickType_t xHorizon;
+        BaseType_t xDensity;
+        BaseType_t xSimulated;
+        BaseType_t xCoreSimulated;
+        BaseType_t xTruncated;
+        UBaseType_t uxTasks = 0;
+        UBaseType_t uxLowerBound;
+        UBaseType_t uxMinimum = 0;
+        UBaseType_t uxNeeded;
+        UBaseType_t uxUsed;
+        UBaseType_t uxFit;
+        UBaseType_t uxCore;
+        cTCB_t *pxTCB;
+        ListItem_t *pxTCB_Pointer = listGET_HEAD_ENTRY( pxTASK_List );
+        const ListItem_t *pxTCB_Tail = listGET_END_MARKER( pxTASK_List );
+
+        if( uxCores == 0 || uxCores > configMULTICORE_MAX_CORES ){
+            printf( "\nThe number of cores must be between 1 and %d\n", configMULTICORE_MAX_CORES );
+            return;
+        }
+
+        // The copies of the tasks are moved between the core lists, the Task List is left untouched
+        while( pxTCB_Pointer != pxTCB_Tail ){
+            if( uxTasks == configMULTICORE_MAX_TASKS ){
+                printf( "\nMore than %d periodic tasks\n", configMULTICORE_MAX_TASKS );
                 return;
             }
-            else
-            {
-                cTCBA_t *pxTCBA;
-                TaskHandle_t xTaskCurrentHandle = xTaskGetCurrentTaskHandle();
+            pxTCB = &xCoreTCBs[ uxTasks ];
+            *pxTCB = *( cTCB_t * ) listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+            pxTCB->xWCRT = pxTCB->xWCET;
+            vListInitialiseItem( &pxTCB->pxTCBItem );
+            listSET_LIST_ITEM_OWNER( &pxTCB->pxTCBItem, pxTCB );
+            listSET_LIST_ITEM_VALUE( &pxTCB->pxTCBItem, pxTCB->xPeriod );
+            xU += (float) pxTCB->xWCET / pxTCB->xPeriod;
+            uxTasks++;
+            pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+        }
+        uxLowerBound = ( UBaseType_t ) xU;
+        if( (float) uxLowerBound < xU )
+            uxLowerBound++;
+        printf( "\nTasks %lu - Utilisation %lu%% - Lower bound %lu cores\n", uxTasks, ( UBaseType_t ) ( xU * 100 + 0.5f ),
+                uxLowerBound );
+        printf( "\nCORES,heuristic,key,min_cores,cores,assigned,simulated\n" );
 
-                // Get pointer to the TCB of the Polling Server
-                cTCB_t *pxTCB = prvGetTCBFromListByHandleRMS(xTaskCurrentHandle);
+        for( uxFit = 0; uxFit < 3; uxFit++ ){
+            for( xDensity = pdFALSE; xDensity <= pdTRUE; xDensity++ ){
+                // Smallest number of cores: a core is opened only when the task fits none of the opened ones
+                uxNeeded = prvMulticoreAssign( uxTasks, uxFit, xDensity, configMULTICORE_MAX_CORES, pdTRUE );
+                if( uxNeeded != 0 && ( uxMinimum == 0 || uxNeeded < uxMinimum ) ){
+                    uxMinimum = uxNeeded;
+                    pcBestFit = pcFits[ uxFit ];
+                    pcBestKey = pcKeys[ xDensity ];
+                }
 
-                // Get the first aperiodic task from the Aperiodic FIFO queue
-                ListItem_t *pxTCBA_Pointer = listGET_HEAD_ENTRY( pxAperiodicTASK_List );
-                pxTCBA = listGET_LIST_ITEM_OWNER( pxTCBA_Pointer );
+                uxUsed = prvMulticoreAssign( uxTasks, uxFit, xDensity, uxCores, pdFALSE );
+                printf( "\nHeuristic %s decreasing %s - Minimum cores %lu - ", pcFits[ uxFit ], pcKeys[ xDensity ], uxNeeded );
+                if( uxUsed == 0 )
+                    printf( "NOT ASSIGNED on %lu cores\n", uxCores );
+                else printf( "ASSIGNED on %lu cores\n", uxCores );
 
-                // Check if the WCET of the aperiodic meets the budget of the polling server. If yes, execute it
-                if(pxTCBA->xWCET < pxTCB->xBudgetPS){
-                    pxTCBA->pxTaskCode( pxTCBA->pvParameters );
-                    printf("\n[PS] Aperiodic Task %s executed - Polling Server Budget = %lu\n",
-                           pxTCBA->pcName, pxTCB->xBudgetPS);
-                }
-                else    //Reset budget of Polling Server
-                {
-                    pxTCB->xBudgetPS = configMAX_BUDGET_PS;
-                    printf("[PS] Next Aperiodic Task %s not schedulable - Reset Polling Server Budget to %lu\n",
-                           pxTCBA->pcName, pxTCB->xBudgetPS);
-                    return;
+                xSimulated = pdTRUE;
+                for( uxCore = 0; uxCore < uxCores && uxUsed != 0; uxCore++ ){
+                    xCoreSimulated = prvMulticoreSimulate( &xCore_Lists[ uxCore ], &xHorizon, &xTruncated );
+                    // A truncated simulation without misses is inconclusive: the core is not counted as validated
+                    if( xCoreSimulated == pdFALSE || xTruncated == pdTRUE )
+                        xSimulated = pdFALSE;
+                    printf( "Core %lu - Utilisation %lu%% - Simulation over %lu ticks %s\n", uxCore,
+                            ( UBaseType_t ) ( prvMulticoreGetLoad( &xCore_Lists[ uxCore ], pdFALSE ) * 100 + 0.5f ), xHorizon,
+                            ( xCoreSimulated == pdFALSE ) ? "MISSED" :
+                            ( xTruncated == pdTRUE ) ? "TRUNCATED - Inconclusive" : "OK" );
+                    pxTCB_Pointer = listGET_HEAD_ENTRY( &xCore_Lists[ uxCore ] );
+                    pxTCB_Tail = listGET_END_MARKER( &xCore_Lists[ uxCore ] );
+                    while( pxTCB_Pointer != pxTCB_Tail ){
+                        pxTCB = listGET_LIST_ITEM_OWNER( pxTCB_Pointer );
+                        printf( "    Task %s - Period %lu - WCET %lu - Deadline %lu\n", pxTCB->pcName, pxTCB->xPeriod,
+                                pxTCB->xWCET, pxTCB->xDeadline );
+                        pxTCB_Pointer = listGET_NEXT( pxTCB_Pointer );
+                    }
                 }
-                uxListRemove(pxTCBA_Pointer);
+                printf( "CORES,%s,%s,%lu,%lu,%lu,%lu\n", pcFits[ uxFit ], pcKeys[ xDensity ], uxNeeded, uxCores,
+                        ( UBaseType_t ) ( uxUsed != 0 ), ( UBaseType_t ) ( uxUsed != 0 && xSimulated == pdTRUE ) );
             }
         }
-    }
 
-    /* Create Polling Server (periodic) Task */
-    static void prvPollingServerInit(){
-        vPeriodicTaskCreate(prvPollingServerCode, "PS", &xPSHandle, configMINIMAL_STACK_SIZE, NULL,
-                            8,pdMS_TO_TICKS(0),pdMS_TO_TICKS(900), pdMS_TO_TICKS(800), configMAX_BUDGET_PS);
+        if( uxMinimum == 0 )
+            printf( "\nNO ASSIGNMENT FOUND UP TO %d CORES - Lower bound %lu\n", configMULTICORE_MAX_CORES, uxLowerBound );
+        else printf( "\nMINIMUM CORES %lu (%s decreasing %s) - Lower bound %lu\n", uxMinimum, pcBestFit, pcBestKey,
+                     uxLowerBound );
+        printf( "\nMULTICORE ASSIGNMENT COMPLETED\n" );
     }
 #endif
-/**
- * ---------------------------------------------------------------------------------
- */
@@ -15,7 +15,121 @@
 #define configSCHED_PRIO (configMAX_PRIORITIES - 1)
 #define configSCHED_MAX_STACK_DEPTH 2000
 #define configMAX_BUDGET_PS pdMS_TO_TICKS(50)
+#define configMAX_RESOURCES 4
+#define configMAX_FIRM_WINDOW 32
+#define configMK_ABORT_GRACE 10
+#define configMAX_CHAINS 4
+#define configMAX_CHAIN_LENGTH 8
+#define configCHAIN_TUNING 1
+#define configMAX_SPORADIC 8
+#define configSPORADIC_QUEUE_LENGTH 4
+#define configSPORADIC_REJECT 0
+#define configMAX_PARTITIONS 4
+#define configLP_FIXED_POINTS 1
+#define configBACKGROUND_MAX_CHUNK pdMS_TO_TICKS(10)
+#define configMAX_CAPACITIES 16
+#define configMAX_LET_PORTS 4
+#define configMAX_LET_BUFFERS 3
+#define configMAX_LET_READERS 4
+#define configELASTIC_STEP 1
+#define configOVERLOAD_POLICY OVERLOAD_VALUE
+#define configMAX_FIRM_APERIODIC 16
 #define CEIL( x, y )    (( x / y ) + ( x % y != 0 ))
+#define CRITICALITY_LO  0
+#define CRITICALITY_HI  1
+#define POLICY_FIXED    0
+#define POLICY_RM       1
+#define POLICY_EDF      2
+#define OVERLOAD_VALUE  0
+#define OVERLOAD_DENSITY 1
+
+/**
+ * -------------------------------------------------------
+ * Benchmark parameters
+ *
+ * NOTE:
+ *      The task count is doubled at every step of the sweep, starting
+ *      from configBENCH_MIN_TASKS up to configBENCH_MAX_TASKS. With
+ *      configENABLE_POLICY_SELECT every policy is swept in turn
+ * -------------------------------------------------------
+ */
+
+#define configBENCH_MIN_TASKS       2
+#define configBENCH_MAX_TASKS       256
+#define configBENCH_RUNS            20
+#define configBENCH_STACK_DEPTH     128
+
+/**
+ * -------------------------------------------------------
+ * Task-set generator parameters
+ *
+ * NOTE:
+ *      Utilisations and D/T ratios are expressed in percent
+ * -------------------------------------------------------
+ */
+
+#define configGEN_TASKS             10
+#define configGEN_SETS              1000
+#define configGEN_U_MIN             5
+#define configGEN_U_MAX             100
+#define configGEN_U_STEP            5
+#define configGEN_T_MIN             pdMS_TO_TICKS(10)
+#define configGEN_T_MAX             pdMS_TO_TICKS(1000)
+#define configGEN_DT_MIN            100
+#define configGEN_DT_MAX            100
+#define configGEN_SEED              1
+
+/**
+ * -------------------------------------------------------
+ * WCET profiling parameters
+ *
+ * NOTE:
+ *      The Gumbel distribution is fitted to the maxima of the
+ *      blocks of configPROF_BLOCK runs. The exceedance
+ *      probabilities are expressed as exponents (9 means 1e-9)
+ * -------------------------------------------------------
+ */
+
+#define configPROF_RUNS             100
+#define configPROF_BLOCK            10
+#define configPROF_EXCEEDANCE       9
+#define configPROF_EXCEEDANCE_MAX   12
+
+/**
+ * -------------------------------------------------------
+ * Multicore assignment parameters
+ *
+ * NOTE:
+ *      The assignment of every core is validated by simulating
+ *      its schedule from a synchronous release up to the
+ *      hyperperiod plus the longest deadline, cut at
+ *      configMULTICORE_SIM_HORIZON ticks
+ * -------------------------------------------------------
+ */
+
+#define configMULTICORE_MAX_CORES   8
+#define configMULTICORE_MAX_TASKS   32
+#define configMULTICORE_SIM_HORIZON pdMS_TO_TICKS(60000)
+
+/**
+ * -------------------------------------------------------
+ * Overhead calibration parameters
+ *
+ * NOTE:
+ *      The tick interrupt is measured over configOVH_CALIB_TICKS
+ *      ticks, the context switch and the EDF scheduler task over
+ *      configOVH_CALIB_RUNS runs (the maximum is kept)
+ * -------------------------------------------------------
+ */
+
+#define configOVH_CALIB_TICKS       100
+#define configOVH_CALIB_RUNS        20
+
+/* SysTick registers used to extend the tick count to a cycle count */
+#ifndef benchSYSTICK_LOAD_REG
+    #define benchSYSTICK_LOAD_REG           ( *( ( volatile uint32_t * ) 0xe000e014 ) )
+    #define benchSYSTICK_CURRENT_VALUE_REG  ( *( ( volatile uint32_t * ) 0xe000e018 ) )
+#endif
 
 /**
  * -------------------------------------------------------
@@ -23,8 +137,123 @@
  *
  * NOTE:
  *      1. To enable fixed priority, RMS MUST be enabled too
- *      2. To enable aperiodic tasks, RMS MUST be enabled too
+ *      2. To enable aperiodic tasks, RMS or EDF MUST be enabled too
  *      3. To enable EDF scheduler, all others MUST be disabled
+ *      4. The benchmark measures the algorithm enabled above, the
+ *         priorities are raised in FreeRTOSConfig.h by mainBENCHMARK_DEMO
+ *      5. To enable the task-set generator, RMS or EDF MUST be enabled
+ *         and fixed priority disabled
+ *      6. To enable the slack stealer, RMS and aperiodic tasks MUST be
+ *         enabled too and fixed priority disabled: it replaces the
+ *         Polling Server
+ *      7. To enable preemption thresholds, RMS MUST be enabled too and
+ *         fixed priority, aperiodic tasks and the benchmark disabled
+ *      8. To enable the Stack Resource Policy, RMS or EDF MUST be enabled
+ *         too. Resources MUST be given back in the reverse order they
+ *         were taken
+ *      9. To enable mixed criticality, RMS MUST be enabled too and fixed
+ *         priority, aperiodic tasks and preemption thresholds disabled
+ *     10. To enable (m,k)-firm tasks, RMS MUST be enabled too and fixed
+ *         priority, preemption thresholds, SRP and mixed criticality
+ *         disabled. k is at most configMAX_FIRM_WINDOW. An optional job
+ *         still running at its deadline is asked to give up (polling
+ *         xPeriodicJobAborted()); configMK_ABORT_GRACE ticks later its
+ *         task is deleted and created again, so it MUST NOT hold
+ *         resources or locks
+ *     11. To enable the WCET profiling, RMS or EDF MUST be enabled:
+ *         vTaskStartProfiling() replaces vTaskStartRealTimeScheduler()
+ *     12. To enable the overhead-aware analysis, RMS or EDF MUST be
+ *         enabled too and fixed priority and preemption thresholds
+ *         disabled
+ *     13. To enable arbitrary deadlines (D > T), RMS MUST be enabled
+ *         too and fixed priority, preemption thresholds, mixed
+ *         criticality and (m,k)-firm tasks disabled
+ *     14. To enable task chains, RMS MUST be enabled too and fixed
+ *         priority, preemption thresholds, mixed criticality, (m,k)-firm
+ *         tasks and the overhead-aware analysis disabled. With
+ *         configCHAIN_TUNING the RMS ties and the release offsets of
+ *         the chained tasks are changed to shorten the chains
+ *     15. To enable sporadic tasks, RMS or EDF MUST be enabled too and
+ *         fixed priority, preemption thresholds, mixed criticality and
+ *         (m,k)-firm tasks disabled. The arrivals closer than the
+ *         minimum inter-arrival time are deferred, or rejected with
+ *         configSPORADIC_REJECT. A sporadic task can only be the head
+ *         of a chain
+ *     16. To enable partitions, RMS or EDF MUST be enabled too and
+ *         fixed priority, aperiodic tasks, preemption thresholds, SRP,
+ *         mixed criticality, (m,k)-firm tasks, the overhead-aware
+ *         analysis, arbitrary deadlines and task chains disabled. The
+ *         partitions are scheduled by RMS on their periods, the tasks
+ *         inside a partition by the algorithm enabled above
+ *     17. To enable the multicore assignment, RMS or EDF MUST be enabled
+ *         too and fixed priority, SRP, mixed criticality, (m,k)-firm
+ *         tasks and arbitrary deadlines disabled:
+ *         vRunMulticoreAssignment() replaces vTaskStartRealTimeScheduler()
+ *     18. To enable dual-priority scheduling, RMS MUST be enabled too and
+ *         fixed priority, the slack stealer, preemption thresholds, SRP,
+ *         mixed criticality, (m,k)-firm tasks, arbitrary deadlines, task
+ *         chains, sporadic tasks and partitions disabled. The Polling
+ *         Server is a soft task
+ *     19. To enable limited preemption, RMS MUST be enabled too and fixed
+ *         priority, the slack stealer, preemption thresholds, SRP, mixed
+ *         criticality, (m,k)-firm tasks, arbitrary deadlines, partitions
+ *         and dual-priority scheduling disabled. With
+ *         configLP_FIXED_POINTS the jobs are non-preemptive between their
+ *         preemption points, otherwise only inside the regions they mark
+ *     20. To enable co-routine jobs, RMS or EDF MUST be enabled too. A
+ *         periodic task created with stack depth 0 runs to completion as
+ *         a co-routine on the stack of the Idle Task, in background of
+ *         the other tasks, with deadline monotonic priority among the
+ *         co-routines (configMAX_CO_ROUTINE_PRIORITIES in FreeRTOSConfig.h).
+ *         A co-routine job runs in the Idle Task, so it MUST NOT block
+ *         (no delay, no waiting on a queue or a semaphore).
+ *         configUSE_CO_ROUTINES is only set with mainCOROUTINES_DEMO
+ *     21. To enable the runtime policy selection, EDF MUST be enabled too
+ *         (its Task List and Scheduler Task host every policy) and SRP,
+ *         partitions and the multicore assignment disabled:
+ *         vInitSchedulerPolicy() replaces vInitScheduler()
+ *     22. The background work queue can be enabled with every algorithm.
+ *         The works are drained by the Idle Hook one chunk at a time, so
+ *         a chunk MUST NOT block and MUST last at most
+ *         configBACKGROUND_MAX_CHUNK (the blocking of the co-routines)
+ *     23. To enable the slack reclaiming, RMS or EDF and aperiodic tasks
+ *         MUST be enabled too and fixed priority, the slack stealer and
+ *         dual-priority scheduling disabled. The budget left by the early
+ *         completions is used by the Polling Server (at most
+ *         configMAX_CAPACITIES capacities are queued). The server is
+ *         suspended until its next release once its budget and the
+ *         eligible capacities are exhausted
+ *     24. To enable the Logical Execution Time, RMS or EDF MUST be enabled
+ *         too and preemption thresholds, the overhead-aware analysis,
+ *         arbitrary deadlines, task chains and sporadic tasks disabled.
+ *         The ports are read and written by periodic tasks only (not by
+ *         the co-routine jobs)
+ *     25. To enable elastic periods, RMS or EDF MUST be enabled too and
+ *         fixed priority, the slack stealer, preemption thresholds, SRP,
+ *         mixed criticality, the overhead-aware analysis, arbitrary
+ *         deadlines, task chains, sporadic tasks, partitions,
+ *         dual-priority scheduling, limited preemption, co-routine jobs,
+ *         the runtime policy selection and the Logical Execution Time
+ *         disabled. The desired utilisation is lowered by
+ *         configELASTIC_STEP percent until the compressed periods pass
+ *         the WCRT test. The new periods take effect at the job
+ *         boundaries; under RMS the priorities stay the ones of the
+ *         nominal periods. A heavier WCET given at runtime is used
+ *         only once every stretched period is in use
+ *     26. To enable the overload manager, EDF MUST be enabled too and
+ *         SRP, the overhead-aware analysis, sporadic tasks, partitions,
+ *         the runtime policy selection, the Logical Execution Time and
+ *         elastic periods disabled. A task set failing the feasibility
+ *         test is started anyway. With configOVERLOAD_POLICY the jobs
+ *         of least value (OVERLOAD_VALUE) or value per WCET tick
+ *         (OVERLOAD_DENSITY) are rejected; only the jobs not started
+ *         yet can be rejected
+ *     27. To enable firm aperiodic tasks, RMS or EDF and aperiodic tasks
+ *         MUST be enabled too and fixed priority, the slack stealer and
+ *         dual-priority scheduling disabled. The Polling Server gets its
+ *         budget back at every job and serves the firm jobs first, by
+ *         deadline; at most configMAX_FIRM_APERIODIC are queued. They
+ *         are submitted once the scheduler runs
  * -------------------------------------------------------
  */
 
@@ -32,6 +261,135 @@
 #define configENABLE_RM         1
 #define configENABLE_FIXED      0
 #define configENABLE_APERIODIC  0
+#define configENABLE_SLACK_STEALING 0
+#define configENABLE_PREEMPTION_THRESHOLD 0
+#define configENABLE_SRP        0
+#define configENABLE_MIXED_CRITICALITY 0
+#define configENABLE_MK_FIRM    0
+#define configENABLE_OVERHEADS  0
+#define configENABLE_ARBITRARY_DEADLINE 0
+#define configENABLE_CHAINS     0
+#define configENABLE_SPORADIC   0
+#define configENABLE_PARTITIONS 0
+#define configENABLE_DUAL_PRIORITY 0
+#define configENABLE_LIMITED_PREEMPTION 0
+#define configENABLE_COROUTINES 0
+#define configENABLE_POLICY_SELECT 0
+#define configENABLE_BACKGROUND 0
+#define configENABLE_RECLAIMING 0
+#define configENABLE_LET 0
+#define configENABLE_ELASTIC 0
+#define configENABLE_OVERLOAD 0
+#define configENABLE_FIRM_APERIODIC 0
+#define configENABLE_BENCHMARK  0
+#define configENABLE_GENERATOR  0
+#define configENABLE_PROFILING  0
+#define configENABLE_MULTICORE  0
+
+/* Rules of the NOTE list above, checked at compile time */
+#if( configENABLE_FIXED == 1 && configENABLE_RM == 0 )
+    #error "NOTE 1: fixed priority needs configENABLE_RM"
+#endif
+#if( configENABLE_APERIODIC == 1 && ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) )
+    #error "NOTE 2: aperiodic tasks need configENABLE_RM or configENABLE_EDF"
+#endif
+#if( configENABLE_EDF == 1 && ( configENABLE_RM == 1 || configENABLE_FIXED == 1 ) )
+    #error "NOTE 3: EDF excludes RMS and fixed priority"
+#endif
+#if( configENABLE_GENERATOR == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 ) )
+    #error "NOTE 5: the task-set generator needs RMS or EDF without fixed priority"
+#endif
+#if( configENABLE_SLACK_STEALING == 1 && ( configENABLE_RM == 0 || configENABLE_APERIODIC == 0 || configENABLE_FIXED == 1 ) )
+    #error "NOTE 6: the slack stealer needs RMS and aperiodic tasks without fixed priority"
+#endif
+#if( configENABLE_PREEMPTION_THRESHOLD == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_APERIODIC == 1 || \
+                                                 configENABLE_BENCHMARK == 1 ) )
+    #error "NOTE 7: preemption thresholds need RMS without fixed priority, aperiodic tasks and the benchmark"
+#endif
+#if( configENABLE_SRP == 1 && ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) )
+    #error "NOTE 8: SRP needs configENABLE_RM or configENABLE_EDF"
+#endif
+#if( configENABLE_MIXED_CRITICALITY == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_APERIODIC == 1 || \
+                                              configENABLE_PREEMPTION_THRESHOLD == 1 ) )
+    #error "NOTE 9: mixed criticality needs RMS without fixed priority, aperiodic tasks and preemption thresholds"
+#endif
+#if( configENABLE_MK_FIRM == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 || \
+                                    configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 ) )
+    #error "NOTE 10: (m,k)-firm tasks need RMS without fixed priority, preemption thresholds, SRP and mixed criticality"
+#endif
+#if( configENABLE_PROFILING == 1 && ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) )
+    #error "NOTE 11: the WCET profiling needs configENABLE_RM or configENABLE_EDF"
+#endif
+#if( configENABLE_OVERHEADS == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 ) )
+    #error "NOTE 12: the overhead-aware analysis needs RMS or EDF without fixed priority and preemption thresholds"
+#endif
+#if( configENABLE_ARBITRARY_DEADLINE == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 || \
+                                               configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 ) )
+    #error "NOTE 13: arbitrary deadlines need RMS without fixed priority, preemption thresholds, mixed criticality and (m,k)-firm tasks"
+#endif
+#if( configENABLE_CHAINS == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 || \
+                                   configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 || configENABLE_OVERHEADS == 1 ) )
+    #error "NOTE 14: task chains need RMS without fixed priority, preemption thresholds, mixed criticality, (m,k)-firm tasks and the overhead-aware analysis"
+#endif
+#if( configENABLE_SPORADIC == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 || configENABLE_PREEMPTION_THRESHOLD == 1 || \
+                                     configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 ) )
+    #error "NOTE 15: sporadic tasks need RMS or EDF without fixed priority, preemption thresholds, mixed criticality and (m,k)-firm tasks"
+#endif
+#if( configENABLE_PARTITIONS == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 || configENABLE_APERIODIC == 1 || \
+                                       configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || \
+                                       configENABLE_MK_FIRM == 1 || configENABLE_OVERHEADS == 1 || configENABLE_ARBITRARY_DEADLINE == 1 || \
+                                       configENABLE_CHAINS == 1 ) )
+    #error "NOTE 16: partitions need RMS or EDF without fixed priority, aperiodic tasks, preemption thresholds, SRP, mixed criticality, (m,k)-firm tasks, the overhead-aware analysis, arbitrary deadlines and task chains"
+#endif
+#if( configENABLE_MULTICORE == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 || configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || \
+                                      configENABLE_MK_FIRM == 1 || configENABLE_ARBITRARY_DEADLINE == 1 ) )
+    #error "NOTE 17: the multicore assignment needs RMS or EDF without fixed priority, SRP, mixed criticality, (m,k)-firm tasks and arbitrary deadlines"
+#endif
+#if( configENABLE_DUAL_PRIORITY == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_SLACK_STEALING == 1 || \
+                                          configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || \
+                                          configENABLE_MK_FIRM == 1 || configENABLE_ARBITRARY_DEADLINE == 1 || configENABLE_CHAINS == 1 || \
+                                          configENABLE_SPORADIC == 1 || configENABLE_PARTITIONS == 1 ) )
+    #error "NOTE 18: dual-priority scheduling needs RMS without fixed priority, the slack stealer, preemption thresholds, SRP, mixed criticality, (m,k)-firm tasks, arbitrary deadlines, task chains, sporadic tasks and partitions"
+#endif
+#if( configENABLE_LIMITED_PREEMPTION == 1 && ( configENABLE_RM == 0 || configENABLE_FIXED == 1 || configENABLE_SLACK_STEALING == 1 || \
+                                               configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_SRP == 1 || \
+                                               configENABLE_MIXED_CRITICALITY == 1 || configENABLE_MK_FIRM == 1 || \
+                                               configENABLE_ARBITRARY_DEADLINE == 1 || configENABLE_PARTITIONS == 1 || \
+                                               configENABLE_DUAL_PRIORITY == 1 ) )
+    #error "NOTE 19: limited preemption needs RMS without fixed priority, the slack stealer, preemption thresholds, SRP, mixed criticality, (m,k)-firm tasks, arbitrary deadlines, partitions and dual-priority scheduling"
+#endif
+#if( configENABLE_COROUTINES == 1 && ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) )
+    #error "NOTE 20: co-routine jobs need configENABLE_RM or configENABLE_EDF"
+#endif
+#if( configENABLE_POLICY_SELECT == 1 && ( configENABLE_EDF == 0 || configENABLE_SRP == 1 || configENABLE_PARTITIONS == 1 || \
+                                          configENABLE_MULTICORE == 1 ) )
+    #error "NOTE 21: the runtime policy selection needs EDF without SRP, partitions and the multicore assignment"
+#endif
+#if( configENABLE_RECLAIMING == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_APERIODIC == 0 || configENABLE_FIXED == 1 || \
+                                       configENABLE_SLACK_STEALING == 1 || configENABLE_DUAL_PRIORITY == 1 ) )
+    #error "NOTE 23: the slack reclaiming needs RMS or EDF and aperiodic tasks without fixed priority, the slack stealer and dual-priority scheduling"
+#endif
+#if( configENABLE_LET == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_OVERHEADS == 1 || \
+                                configENABLE_ARBITRARY_DEADLINE == 1 || configENABLE_CHAINS == 1 || configENABLE_SPORADIC == 1 ) )
+    #error "NOTE 24: the Logical Execution Time needs RMS or EDF without preemption thresholds, the overhead-aware analysis, arbitrary deadlines, task chains and sporadic tasks"
+#endif
+#if( configENABLE_ELASTIC == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_FIXED == 1 || configENABLE_SLACK_STEALING == 1 || \
+                                    configENABLE_PREEMPTION_THRESHOLD == 1 || configENABLE_SRP == 1 || configENABLE_MIXED_CRITICALITY == 1 || \
+                                    configENABLE_OVERHEADS == 1 || configENABLE_ARBITRARY_DEADLINE == 1 || configENABLE_CHAINS == 1 || \
+                                    configENABLE_SPORADIC == 1 || configENABLE_PARTITIONS == 1 || configENABLE_DUAL_PRIORITY == 1 || \
+                                    configENABLE_LIMITED_PREEMPTION == 1 || configENABLE_COROUTINES == 1 || configENABLE_POLICY_SELECT == 1 || \
+                                    configENABLE_LET == 1 ) )
+    #error "NOTE 25: elastic periods need RMS or EDF without the features listed in the NOTE"
+#endif
+#if( configENABLE_OVERLOAD == 1 && ( configENABLE_EDF == 0 || configENABLE_SRP == 1 || configENABLE_OVERHEADS == 1 || \
+                                     configENABLE_SPORADIC == 1 || configENABLE_PARTITIONS == 1 || configENABLE_POLICY_SELECT == 1 || \
+                                     configENABLE_LET == 1 || configENABLE_ELASTIC == 1 ) )
+    #error "NOTE 26: the overload manager needs EDF without SRP, the overhead-aware analysis, sporadic tasks, partitions, the runtime policy selection, the Logical Execution Time and elastic periods"
+#endif
+#if( configENABLE_FIRM_APERIODIC == 1 && ( ( configENABLE_RM == 0 && configENABLE_EDF == 0 ) || configENABLE_APERIODIC == 0 || configENABLE_FIXED == 1 || \
+                                           configENABLE_SLACK_STEALING == 1 || configENABLE_DUAL_PRIORITY == 1 ) )
+    #error "NOTE 27: firm aperiodic tasks need RMS or EDF and aperiodic tasks without fixed priority, the slack stealer and dual-priority scheduling"
+#endif
 
 /**
  * -------------------------------------------------------
@@ -39,11 +397,55 @@
  * -------------------------------------------------------
  */
 
+/* One chunk of a background work: uxChunk counts the chunks already executed, pdTRUE is returned once the work is complete */
+typedef BaseType_t ( *BackgroundChunkFunction_t )( void *pvParameters, UBaseType_t uxChunk );
+
 void vInitScheduler();
+void vInitSchedulerPolicy( UBaseType_t uxPolicy );
 void vPeriodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHandle_t *pxTaskHandle,
                           const uint32_t ulStackDepth, void *pvParameters, BaseType_t xPriority,
                           TickType_t xArrivalTime, TickType_t xPeriod, TickType_t xDeadline, TickType_t xWCET);
 void vAperiodicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, void *pvParameters, TickType_t xWCET);
+BaseType_t xAperiodicTaskCreateFirm( TaskFunction_t pxTaskCode, const char *pcName, void *pvParameters, TickType_t xWCET,
+                                     TickType_t xDeadline );
+void vSporadicTaskCreate( TaskFunction_t pxTaskCode, const char *pcName, TaskHandle_t *pxTaskHandle,
+                          const uint32_t ulStackDepth, void *pvParameters, BaseType_t xPriority,
+                          TickType_t xMinInterArrival, TickType_t xDeadline, TickType_t xWCET);
+BaseType_t xSporadicTaskRelease( TaskHandle_t *pxTaskHandle );
+BaseType_t xSporadicTaskReleaseFromISR( TaskHandle_t *pxTaskHandle, BaseType_t *pxHigherPriorityTaskWoken );
+void vResourceUse( TaskHandle_t *pxTaskHandle, UBaseType_t uxResource, TickType_t xCSLength );
+void vResourceTake( UBaseType_t uxResource );
+void vResourceGive( UBaseType_t uxResource );
+void vPreemptionPoint();
+void vNPRBegin();
+void vNPREnd();
+void vPeriodicTaskSetCriticality( TaskHandle_t *pxTaskHandle, BaseType_t xCriticality, TickType_t xWCETHigh );
+void vPeriodicTaskSetFirm( TaskHandle_t *pxTaskHandle, UBaseType_t uxM, UBaseType_t uxK );
+BaseType_t xPeriodicJobAborted();
+void vPeriodicTaskSetTrigger( TaskHandle_t *pxTaskHandle, TaskHandle_t *pxTriggerHandle );
+void vPeriodicTaskSetSoft( TaskHandle_t *pxTaskHandle );
+void vChainCreate( UBaseType_t uxChain, const char *pcName, TickType_t xDeadline );
+void vChainAddTask( UBaseType_t uxChain, TaskHandle_t *pxTaskHandle );
+void vPartitionCreate( UBaseType_t uxPartition, const char *pcName, TickType_t xPeriod, TickType_t xBudget );
+void vPartitionAddTask( UBaseType_t uxPartition, TaskHandle_t *pxTaskHandle );
+BaseType_t xBackgroundWorkCreate( BackgroundChunkFunction_t pxChunkCode, const char *pcName, void *pvParameters,
+                                  UBaseType_t uxChunks, TickType_t xChunkWCET );
+void vBackgroundWorkReport();
+void vLETPortCreate( UBaseType_t uxPort, const char *pcName, TaskHandle_t *pxWriterHandle, void *pvBufferA,
+                     void *pvBufferB );
+void vLETPortAddBuffer( UBaseType_t uxPort, void *pvBuffer );
+void vLETPortAddReader( UBaseType_t uxPort, TaskHandle_t *pxReaderHandle );
+void *pvLETOutput( UBaseType_t uxPort );
+const void *pvLETInput( UBaseType_t uxPort );
+void vPeriodicTaskSetElastic( TaskHandle_t *pxTaskHandle, TickType_t xPeriodMax, UBaseType_t uxElasticity );
+BaseType_t xPeriodicTaskSetWCET( TaskHandle_t *pxTaskHandle, TickType_t xWCET );
+void vPeriodicTaskSetValue( TaskHandle_t *pxTaskHandle, UBaseType_t uxValue, TickType_t xTolerance );
+void vOverloadReport();
 void vTaskStartRealTimeScheduler();
+uint64_t ullGetTickCount64();
+void vTaskStartSchedulerBenchmark();
+void vRunSchedulabilityBenchmark();
+void vTaskStartProfiling();
+void vRunMulticoreAssignment( UBaseType_t uxCores );
 
 #endif
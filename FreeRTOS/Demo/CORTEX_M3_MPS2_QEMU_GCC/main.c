@@ -59,6 +59,39 @@ TaskHandle_t xClient3_Handle = NULL;
 TaskHandle_t xDNS = NULL;
 TaskHandle_t xFirmware = NULL;
 
+#if ( mainSRP_DEMO == 1 )
+    /* The console is shared (resource 0) by Client1 and Client3: their whole jobs are critical sections */
+    static void prvClient_PING_Console( void *pvParameters ){
+        vResourceTake( 0 );
+        vClient_PING( pvParameters );
+        vResourceGive( 0 );
+    }
+
+    static void prvClient_FTP_Console( void *pvParameters ){
+        vResourceTake( 0 );
+        vClient_FTP( pvParameters );
+        vResourceGive( 0 );
+    }
+#endif
+
+#if ( mainSPORADIC_DEMO == 1 )
+    /* Every ping of Client1 raises two requests to the Server, the second one earlier than its minimum inter-arrival time */
+    static void prvClient_PING_Request( void *pvParameters ){
+        vClient_PING( pvParameters );
+        xSporadicTaskRelease( &xDNS );
+        xSporadicTaskRelease( &xDNS );
+    }
+#endif
+
+#if ( mainRM_LIMITED_PREEMPTION_DEMO == 1 )
+    /* The file transfer is confirmed by a ping: with fixed preemption points the job can only be preempted between the two */
+    static void prvClient_FTP_Ping( void *pvParameters ){
+        vClient_FTP( pvParameters );
+        vPreemptionPoint();
+        vClient_PING( pvParameters );
+    }
+#endif
+
 int main()
 {
 #if ( mainASSIGN_IP_DEMO == 1 )
@@ -258,6 +291,681 @@ int main()
 
         vTaskStartRealTimeScheduler();
 
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_SLACK_STEALING_DEMO == 1 )
+    {
+        /*--------------Activate RMS and Slack Stealer--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_APERIODIC 1
+            #define configENABLE_SLACK_STEALING 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(700), pdMS_TO_TICKS(600), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(400), pdMS_TO_TICKS(200));
+
+        vAperiodicTaskCreate(DNS, "Server", &xDNS, pdMS_TO_TICKS(24));
+        vAperiodicTaskCreate(DNS, "Server", &xDNS, pdMS_TO_TICKS(24));
+        vAperiodicTaskCreate(Firmware, "Server", &xFirmware, pdMS_TO_TICKS(40));
+        vAperiodicTaskCreate(Firmware, "Server", &xFirmware, pdMS_TO_TICKS(40));
+
+        vTaskStartRealTimeScheduler();
+        //The aperiodic tasks are served as soon as the slack allows it, without a server budget
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_PREEMPTION_THRESHOLD_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Preemption Thresholds--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_PREEMPTION_THRESHOLD 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(150), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(100));
+
+        vTaskStartRealTimeScheduler();
+        //The thresholds are raised as long as the WCRT test passes, the tasks that can not preempt each other share a stack
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainSRP_DEMO == 1 )
+    {
+        /*--------------Activate RMS (or EDF) with the Stack Resource Policy--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_SRP 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(prvClient_PING_Console, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(prvClient_FTP_Console, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(100));
+        vResourceUse(&xClient1_Handle, 0, pdMS_TO_TICKS(50));
+        vResourceUse(&xClient3_Handle, 0, pdMS_TO_TICKS(100));
+
+        vTaskStartRealTimeScheduler();
+        //Client1 and Client2 can be blocked once by the critical section of Client3, as accounted in the WCRT
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_MIXED_CRITICALITY_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Mixed Criticality (AMC)--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_APERIODIC 0
+            #define configENABLE_MIXED_CRITICALITY 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(20));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(200));
+        vPeriodicTaskSetCriticality(&xClient1_Handle, CRITICALITY_HI, pdMS_TO_TICKS(100));
+
+        vTaskStartRealTimeScheduler();
+        //Client1 overruns its LO WCET: Client2 and Client3 are dropped until the next idle instant
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_MK_FIRM_DEMO == 1 )
+    {
+        /*--------------Activate RMS with (m,k)-firm Tasks--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_MK_FIRM 1
+        */
+        TaskHandle_t xBackup = NULL;
+
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(200), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(200));
+        vPeriodicTaskCreate(Backup, "Backup", &xBackup, configMINIMAL_STACK_SIZE, NULL, 6,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(150), pdMS_TO_TICKS(40), pdMS_TO_TICKS(10));
+        vPeriodicTaskSetFirm(&xClient2_Handle, 1, 2);
+        vPeriodicTaskSetFirm(&xBackup, 2, 3);
+
+        vTaskStartRealTimeScheduler();
+        //The utilization is above 1 (standard test not passed) but the mandatory jobs of Client2 (one out of two) are guaranteed
+        //Backup overruns its deadline while its link stalls: two misses in a row violate (2,3) and a dynamic failure is reported
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainOVERHEADS_DEMO == 1 )
+    {
+        /*--------------Activate RMS (or EDF) with the overhead-aware analysis--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_OVERHEADS 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(100));
+
+        vTaskStartRealTimeScheduler();
+        //The same task set of the WCRT demo: the tasks are released after the calibration, with the WCETs inflated
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_ARBITRARY_DEADLINE_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Arbitrary Deadlines (D > T)--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_ARBITRARY_DEADLINE 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(200), pdMS_TO_TICKS(400), pdMS_TO_TICKS(120));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(500), pdMS_TO_TICKS(900), pdMS_TO_TICKS(180));
+
+        vTaskStartRealTimeScheduler();
+        //The first job of Client2 completes after its period (540 ms), the second one is queued behind it
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_CHAINS_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Task Chains--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_CHAINS 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(100),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(30));
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(200));
+        // Client1 asks for an IP, the Server assigns it and Client2 (released by the Server) configures it
+        vPeriodicTaskSetTrigger(&xClient2_Handle, &xDNS);
+        vChainCreate(0, "AssignIP", pdMS_TO_TICKS(800));
+        vChainAddTask(0, &xClient1_Handle);
+        vChainAddTask(0, &xDNS);
+        vChainAddTask(0, &xClient2_Handle);
+
+        vTaskStartRealTimeScheduler();
+        //The Server is moved after Client1 (priority and offset): without configCHAIN_TUNING the latency exceeds 800 ms
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainSPORADIC_DEMO == 1 )
+    {
+        /*--------------Activate RMS (or EDF) with Sporadic Tasks--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_SPORADIC 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(prvClient_PING_Request, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(200));
+        vSporadicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(200),
+                            pdMS_TO_TICKS(200), pdMS_TO_TICKS(30));
+
+        vTaskStartRealTimeScheduler();
+        //The second request of every pair is deferred by 200 ms (rejected with configSPORADIC_REJECT)
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainPARTITIONS_DEMO == 1 )
+    {
+        /*--------------Activate RMS (or EDF) with Partitions--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_PARTITIONS 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1600), pdMS_TO_TICKS(1600), pdMS_TO_TICKS(200));
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(30));
+
+        // The clients can not take more than their budget from the DNS server, whatever they execute
+        vPartitionCreate( 0, "Clients", pdMS_TO_TICKS(100), pdMS_TO_TICKS(60) );
+        vPartitionCreate( 1, "Services", pdMS_TO_TICKS(200), pdMS_TO_TICKS(40) );
+        vPartitionAddTask( 0, &xClient1_Handle );
+        vPartitionAddTask( 0, &xClient2_Handle );
+        vPartitionAddTask( 0, &xClient3_Handle );
+        vPartitionAddTask( 1, &xDNS );
+
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_DUAL_PRIORITY_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Dual-Priority Scheduling--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_DUAL_PRIORITY 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(200));
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(60));
+
+        // The page download has no guarantee but it is served before the hard jobs until their promotion
+        vPeriodicTaskSetSoft( &xClient2_Handle );
+
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRM_LIMITED_PREEMPTION_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Limited Preemption--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_LIMITED_PREEMPTION 1
+            #define configLP_FIXED_POINTS 1     (0 without any region marked for the fully preemptive count)
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(prvClient_FTP_Ping, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1600), pdMS_TO_TICKS(1600), pdMS_TO_TICKS(250));
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(60), pdMS_TO_TICKS(60), pdMS_TO_TICKS(10));
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainCOROUTINES_DEMO == 1 )
+    {
+        /*--------------Activate RMS with Co-routine Jobs--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+            #define configUSE_CO_ROUTINES  = 1
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_COROUTINES 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(60));
+
+        // The pings run to completion as co-routines: no stack (depth 0) and no task handle
+        vPeriodicTaskCreate(vClient_PING, "Client1", NULL, 0, NULL, 0, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_PING, "Client3", NULL, 0, NULL, 0, pdMS_TO_TICKS(100),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_PING, "Client4", NULL, 0, NULL, 0, pdMS_TO_TICKS(200),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(50));
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainPOLICY_SELECT_DEMO == 1 )
+    {
+        /*--------------Select the policy at runtime--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_EDF 1
+            #define configENABLE_FIXED 0
+            #define configENABLE_APERIODIC 1
+            #define configENABLE_POLICY_SELECT 1
+        */
+        // Can be changed from the debugger before vInitSchedulerPolicy: the same binary runs every policy
+        volatile UBaseType_t uxPolicy = POLICY_EDF;
+
+        vInitSchedulerPolicy( uxPolicy );
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 7,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(400), pdMS_TO_TICKS(200));
+
+        vAperiodicTaskCreate(DNS, "Server", &xDNS, pdMS_TO_TICKS(24));
+        vAperiodicTaskCreate(Firmware, "Server", &xFirmware, pdMS_TO_TICKS(40));
+
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainBACKGROUND_DEMO == 1 )
+    {
+        /*--------------Activate RMS with background works in idle time--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_BACKGROUND 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(800), pdMS_TO_TICKS(800), pdMS_TO_TICKS(200));
+
+        // Drained by the Idle Task in chunks of at most configBACKGROUND_MAX_CHUNK, served round robin
+        xBackgroundWorkCreate(FirmwareCRC, "CRC", NULL, FIRMWARE_IMAGE_SIZE / FIRMWARE_CHUNK_SIZE, pdMS_TO_TICKS(2));
+        xBackgroundWorkCreate(LogDrain, "Log", NULL, 8, pdMS_TO_TICKS(1));
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainRECLAIMING_DEMO == 1 )
+    {
+        /*--------------Activate EDF with the Polling Server using the reclaimed budget--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_EDF 1      (or configENABLE_RM 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_APERIODIC 1
+            #define configENABLE_RECLAIMING 1
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1000), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(200));
+
+        // WCETs beyond the budget of the Polling Server: only served with the capacity left by the periodic jobs
+        vAperiodicTaskCreate(DNS, "Server", &xDNS, pdMS_TO_TICKS(60));
+        vAperiodicTaskCreate(Firmware, "Server", &xFirmware, pdMS_TO_TICKS(120));
+
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainLET_DEMO == 1 )
+    {
+        /*--------------Activate RMS with the Logical Execution Time--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_LET 1
+        */
+        static Load_t xLoadBuffers[ 2 ];
+        TaskHandle_t xMonitor = NULL;
+        TaskHandle_t xBalancer = NULL;
+
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(200), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(Monitor, "Monitor", &xMonitor, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(200), pdMS_TO_TICKS(60));
+        vPeriodicTaskCreate(Balancer, "Balancer", &xBalancer, configMINIMAL_STACK_SIZE, NULL, 7,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(200), pdMS_TO_TICKS(20));
+
+        // Published at every deadline of Monitor, latched at every release of Balancer: double buffering is enough
+        // since Balancer completes before the buffer it reads is written again (D_monitor + D_balancer <= T_monitor)
+        vLETPortCreate(LET_PORT_LOAD, "Load", &xMonitor, &xLoadBuffers[ 0 ], &xLoadBuffers[ 1 ]);
+        vLETPortAddReader(LET_PORT_LOAD, &xBalancer);
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainELASTIC_DEMO == 1 )
+    {
+        /*--------------Activate RMS with elastic periods--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_ELASTIC 1
+        */
+        TaskHandle_t xAdmission = NULL;
+
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(200), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(500), pdMS_TO_TICKS(500), pdMS_TO_TICKS(ADMISSION_BASE_WCET));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 7,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1000), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(400));
+        vPeriodicTaskCreate(Admission, "Admission", &xAdmission, configMINIMAL_STACK_SIZE, &xClient2_Handle, 6,
+                            pdMS_TO_TICKS(0), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(10));
+
+        // U = 1.06 at the nominal periods: Client1 and Client2 are stretched (Client2 twice as much), Client3 is rigid
+        vPeriodicTaskSetElastic(&xClient1_Handle, pdMS_TO_TICKS(400), 1);
+        vPeriodicTaskSetElastic(&xClient2_Handle, pdMS_TO_TICKS(2000), 2);
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainOVERLOAD_DEMO == 1 )
+    {
+        /*--------------Activate EDF with the overload manager--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_EDF 1
+            #define configENABLE_RM 0
+            #define configENABLE_FIXED 0
+            #define configENABLE_OVERLOAD 1
+        */
+        TaskHandle_t xReport = NULL;
+
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,9, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(200), pdMS_TO_TICKS(200), pdMS_TO_TICKS(80));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(500), pdMS_TO_TICKS(300), pdMS_TO_TICKS(250));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 7,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1000), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(400));
+        vPeriodicTaskCreate(ValueReport, "Report", &xReport, configMINIMAL_STACK_SIZE, NULL, 6,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(2000), pdMS_TO_TICKS(2000), pdMS_TO_TICKS(10));
+
+        // U = 1.31: a ping and a page released together can not both meet their deadlines, the pings are worth the
+        // most and the file transfer can be late by half a period
+        vPeriodicTaskSetValue(&xClient1_Handle, 10, 0);
+        vPeriodicTaskSetValue(&xClient2_Handle, 5, 0);
+        vPeriodicTaskSetValue(&xClient3_Handle, 1, pdMS_TO_TICKS(500));
+        vPeriodicTaskSetValue(&xReport, 20, 0);
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainFIRM_APERIODIC_DEMO == 1 )
+    {
+        /*--------------Activate RMS with firm aperiodic tasks on the Polling Server--------------
+        In FreeRTOSConfig.h:
+            #define configUSE_PREEMPTION  = 1
+            #define configUSE_TIME_SLICING  = 0
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_APERIODIC 1
+            #define configENABLE_FIRM_APERIODIC 1
+        */
+        TaskHandle_t xRequests = NULL;
+
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(200), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(700), pdMS_TO_TICKS(600), pdMS_TO_TICKS(150));
+        // The requests are submitted at runtime: the acceptance test needs the Polling Server
+        vPeriodicTaskCreate(Requests, "Requests", &xRequests, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1000), pdMS_TO_TICKS(1000), pdMS_TO_TICKS(10));
+
+        // Soft aperiodic tasks, served after the firm ones with the budget left
+        vAperiodicTaskCreate(DNS, "Server", &xDNS, pdMS_TO_TICKS(24));
+
+        vTaskStartRealTimeScheduler();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainBENCHMARK_DEMO == 1 )
+    {
+        /*--------------Scheduler overhead benchmark--------------
+        In FreeRTOSConfig.h:
+            configMAX_PRIORITIES is raised to host up to configBENCH_MAX_TASKS tasks
+        In RealTimeScheduler.h:
+            #define configENABLE_BENCHMARK 1
+            and the flags of the algorithm to be measured (RM, EDF, FIXED, APERIODIC)
+        The results are printed as CSV records starting with "BENCH,"
+        */
+        vInitScheduler();
+        vTaskStartSchedulerBenchmark();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainSCHEDULABILITY_DEMO == 1 )
+    {
+        /*--------------Schedulability ratio of random task sets--------------
+        In RealTimeScheduler.h:
+            #define configENABLE_GENERATOR 1
+            #define configENABLE_FIXED 0
+            and the configGEN_* parameters of the generated task sets
+        The results are printed as CSV records starting with "SCHED,"
+        */
+        vRunSchedulabilityBenchmark();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainPROFILING_DEMO == 1 )
+    {
+        /*--------------Measurement-based WCET profiling--------------
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_PROFILING 1
+            and the configPROF_* parameters
+        The results are printed as CSV records starting with "PROF," and "PWCET,",
+        the generated task-set header as lines starting with "WCET,"
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(100));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(200));
+        vTaskStartProfiling();
+
+        for( ;  ; )
+        {
+        }
+    }
+#elif ( mainMULTICORE_DEMO == 1 )
+    {
+        /*--------------Partitioned multicore task assignment--------------
+        In RealTimeScheduler.h:
+            #define configENABLE_RM 1       (or configENABLE_EDF 1)
+            #define configENABLE_FIXED 0
+            #define configENABLE_MULTICORE 1
+            and the configMULTICORE_* parameters
+        The results are printed as CSV records starting with "CORES,"
+        */
+        vInitScheduler();
+        vPeriodicTaskCreate(vClient_PING, "Client1", &xClient1_Handle, configMINIMAL_STACK_SIZE, NULL,7, pdMS_TO_TICKS(0),
+                                pdMS_TO_TICKS(300), pdMS_TO_TICKS(300), pdMS_TO_TICKS(150));
+        vPeriodicTaskCreate(vClient_WGET, "Client2", &xClient2_Handle, configMINIMAL_STACK_SIZE, NULL, 8,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(400), pdMS_TO_TICKS(400), pdMS_TO_TICKS(200));
+        vPeriodicTaskCreate(vClient_FTP, "Client3", &xClient3_Handle, configMINIMAL_STACK_SIZE, NULL, 9,pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(1200), pdMS_TO_TICKS(1200), pdMS_TO_TICKS(420));
+        vPeriodicTaskCreate(DNS, "Server", &xDNS, configMINIMAL_STACK_SIZE, NULL, 6, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(200), pdMS_TO_TICKS(100), pdMS_TO_TICKS(50));
+        vPeriodicTaskCreate(Firmware, "Firmware", &xFirmware, configMINIMAL_STACK_SIZE, NULL, 5, pdMS_TO_TICKS(0),
+                            pdMS_TO_TICKS(600), pdMS_TO_TICKS(600), pdMS_TO_TICKS(120));
+        // Utilisation 180%: at least two cores, the demo checks whether two are enough
+        vRunMulticoreAssignment( 2 );
+
         for( ;  ; )
         {
         }
@@ -1,9 +1,16 @@
 #include "server.h"
+#include "RealTimeScheduler.h"
 
 static QueueHandle_t xQueuePing = NULL;
 static QueueHandle_t xQueueIP = NULL;
 static QueueHandle_t xQueueHostname = NULL;
 static uint32_t counter = 0UL;
+#if( configENABLE_BACKGROUND == 1 )
+static uint8_t ucFirmwareImage[ FIRMWARE_IMAGE_SIZE ];
+static uint32_t ulFirmwareCRC = 0UL;
+static const char *pcBootLog[] = { "Console ready", "Heap initialised", "IP pool 10.0.1.0/24", "DNS cache loaded",
+                                   "Firmware image received", "Clients polling", "Watchdog armed", "Boot completed" };
+#endif
 
 TaskHandle_t xServerHandle = NULL;
 static void AssignTask(void *pvParameters);
@@ -94,4 +101,125 @@ void Firmware( void *pvParameters ){
     printf("\n[SERVER] Firmware Update");
 }
 
+#if( configENABLE_BACKGROUND == 1 )
+/* Background work: CRC-32 of the firmware image, FIRMWARE_CHUNK_SIZE bytes per chunk */
+BaseType_t FirmwareCRC( void *pvParameters, UBaseType_t uxChunk ){
+    (void) pvParameters;
+    uint32_t i, j;
+    uint32_t ulStart = uxChunk * FIRMWARE_CHUNK_SIZE;
+
+    if( uxChunk == 0 )
+        ulFirmwareCRC = 0xFFFFFFFFUL;
+    for( i = ulStart; i < ulStart + FIRMWARE_CHUNK_SIZE; i++ ){
+        // The image is written by the Firmware update, here it is filled with a pattern
+        ucFirmwareImage[ i ] = ( uint8_t ) ( i * 31 + 7 );
+        ulFirmwareCRC ^= ucFirmwareImage[ i ];
+        for( j = 0; j < 8; j++ )
+            ulFirmwareCRC = ( ulFirmwareCRC >> 1 ) ^ ( 0xEDB88320UL & -( ulFirmwareCRC & 1UL ) );
+    }
+    if( ulStart + FIRMWARE_CHUNK_SIZE < FIRMWARE_IMAGE_SIZE )
+        return pdFALSE;
+    printf("\n[SERVER] Firmware CRC 0x%08lx", ulFirmwareCRC ^ 0xFFFFFFFFUL);
+    return pdTRUE;
+}
+
+/* Background work: drain the boot log, one line per chunk */
+BaseType_t LogDrain( void *pvParameters, UBaseType_t uxChunk ){
+    (void) pvParameters;
+    printf("\n[LOG] %s", pcBootLog[ uxChunk ]);
+    return ( uxChunk + 1 == sizeof( pcBootLog ) / sizeof( pcBootLog[ 0 ] ) );
+}
+#endif
+
+#if( configENABLE_LET == 1 )
+/* Sample the load of the server into the LET output: it is published at the deadline of the job */
+void Monitor( void *pvParameters ){
+    (void) pvParameters;
+    static uint32_t ulSequence = 0UL;
+    Load_t *pxLoad = pvLETOutput( LET_PORT_LOAD );
+    int i;
+    int out;
+
+    for( i = 0; i < 1500000 ; i++ )
+    {
+        out = 1 + i * i * i * i * i * i;
+        out = out / 8;
+    }
+    if( pxLoad != NULL ){
+        pxLoad->ulSequence = ++ulSequence;
+        pxLoad->ulClients = counter;
+        pxLoad->xSampled = xTaskGetTickCount();
+    }
+    printf("\n[SERVER] Load sample %lu taken", ulSequence);
+}
 
+/* Read the load latched at the release of the job: the same sample whenever the job runs */
+void Balancer( void *pvParameters ){
+    (void) pvParameters;
+    const Load_t *pxLoad = pvLETInput( LET_PORT_LOAD );
+
+    if( pxLoad != NULL )
+        printf("\n[SERVER] Balancing on load sample %lu (sampled at %lu) - Tick count %lu", pxLoad->ulSequence,
+               pxLoad->xSampled, xTaskGetTickCount());
+}
+#endif
+
+#if( configENABLE_ELASTIC == 1 )
+/* Admit a new client on the task given (its WCET grows) and let it leave a few jobs later: the periods follow the load */
+void Admission( void *pvParameters ){
+    static uint32_t ulJobs = 0UL;
+    TaskHandle_t *pxServedHandle = ( TaskHandle_t * ) pvParameters;
+
+    ulJobs++;
+    if( ulJobs == ADMISSION_JOIN_JOB ){
+        if( xPeriodicTaskSetWCET( pxServedHandle, pdMS_TO_TICKS( ADMISSION_BASE_WCET + ADMISSION_CLIENT_WCET ) ) == pdTRUE )
+            printf("\n[SERVER] New client admitted - Periods compressed");
+        else printf("\n[SERVER] New client refused");
+    }else if( ulJobs == ADMISSION_LEAVE_JOB ){
+        xPeriodicTaskSetWCET( pxServedHandle, pdMS_TO_TICKS( ADMISSION_BASE_WCET ) );
+        printf("\n[SERVER] Client left - Periods relaxed");
+    }
+}
+#endif
+
+#if( configENABLE_MK_FIRM == 1 )
+/* Copy the logs to the backup host: from job BACKUP_STALL_JOB to BACKUP_RECOVER_JOB the link stalls for
+ * BACKUP_STALL_MS, beyond the deadline, so the mandatory jobs are missed too and the (m,k) constraint is violated.
+ * An optional job gives up the copy once aborted */
+void Backup( void *pvParameters ){
+    static uint32_t ulJobs = 0UL;
+    TickType_t xStart = xTaskGetTickCount();
+    (void) pvParameters;
+
+    ulJobs++;
+    if( ulJobs < BACKUP_STALL_JOB || ulJobs > BACKUP_RECOVER_JOB )
+        return;
+    printf("\n[SERVER] Backup link stalled");
+    while( xTaskGetTickCount() - xStart < pdMS_TO_TICKS( BACKUP_STALL_MS ) ){
+        if( xPeriodicJobAborted() == pdTRUE ){
+            printf("\n[SERVER] Backup given up");
+            return;
+        }
+    }
+    printf("\n[SERVER] Backup completed");
+}
+#endif
+
+#if( configENABLE_OVERLOAD == 1 )
+/* Report the value delivered to the clients so far */
+void ValueReport( void *pvParameters ){
+    (void) pvParameters;
+    vOverloadReport();
+}
+#endif
+
+#if( configENABLE_FIRM_APERIODIC == 1 )
+/* Submit the requests of the clients as firm aperiodic jobs: a DNS update with a loose deadline and a firmware update
+ * with a tight one, rejected at once when the Polling Server can not guarantee it */
+void Requests( void *pvParameters ){
+    (void) pvParameters;
+    xAperiodicTaskCreateFirm( DNS, "DNS", NULL, pdMS_TO_TICKS(24), pdMS_TO_TICKS(REQUEST_DNS_DEADLINE) );
+    if( xAperiodicTaskCreateFirm( Firmware, "Firmware", NULL, pdMS_TO_TICKS(40), pdMS_TO_TICKS(REQUEST_FIRMWARE_DEADLINE) ) == pdFALSE )
+        printf("\n[SERVER] Firmware update postponed");
+}
+#endif
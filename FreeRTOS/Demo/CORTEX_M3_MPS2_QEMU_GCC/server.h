@@ -16,6 +16,25 @@
 
 #define SERVER_TASK_PRIORITY                ( tskIDLE_PRIORITY + 6 )
 #define mainQUEUE_LENGTH                    ( 5 )
+#define FIRMWARE_IMAGE_SIZE                 ( 8192 )
+#define FIRMWARE_CHUNK_SIZE                 ( 256 )
+#define LET_PORT_LOAD                       ( 0 )
+#define ADMISSION_JOIN_JOB                  ( 3 )
+#define ADMISSION_LEAVE_JOB                 ( 6 )
+#define ADMISSION_BASE_WCET                 ( 200 )
+#define ADMISSION_CLIENT_WCET               ( 100 )
+#define REQUEST_DNS_DEADLINE                ( 2000 )
+#define REQUEST_FIRMWARE_DEADLINE           ( 600 )
+#define BACKUP_STALL_JOB                    ( 3 )
+#define BACKUP_RECOVER_JOB                  ( 5 )
+#define BACKUP_STALL_MS                     ( 60 )
+
+/* Load of the server sampled by Monitor and read by Balancer through a LET port */
+typedef struct{
+    uint32_t ulSequence;
+    uint32_t ulClients;
+    TickType_t xSampled;
+}Load_t;
 
 /**
  * -------------------------------------------------------
@@ -29,6 +48,14 @@ QueueHandle_t getQueuePing();
 QueueHandle_t getQueueHostname();
 void Firmware( void *pvParameters );
 void DNS( void *pvParameters );
+BaseType_t FirmwareCRC( void *pvParameters, UBaseType_t uxChunk );
+BaseType_t LogDrain( void *pvParameters, UBaseType_t uxChunk );
+void Monitor( void *pvParameters );
+void Balancer( void *pvParameters );
+void Admission( void *pvParameters );
+void ValueReport( void *pvParameters );
+void Requests( void *pvParameters );
+void Backup( void *pvParameters );
 
 #endif
 
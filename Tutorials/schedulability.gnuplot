@@ -0,0 +1,23 @@
+# Acceptance ratio of the feasibility tests against the utilisation of the task set.
+# Input: the "SCHED," records printed by mainSCHEDULABILITY_DEMO, e.g.
+#   grep "^SCHED," qemu_output.txt > sched.csv
+set datafile separator ","
+set terminal png size 1920,1080
+set output "schedulability.png"
+
+set multiplot layout 1,2
+set xrange [0:100]
+set yrange [0:1.05]
+set xlabel "Utilisation (%)"
+set ylabel "Acceptance ratio"
+set key bottom left
+set grid
+
+do for [periods in "log-uniform harmonic"] {
+    set title sprintf("{/=15 %s periods}", periods)
+    plot "sched.csv" using ( strcol(2) eq periods ? $3 : NaN ):( $5 / $4 ) with linespoints lw 2 title "Hyperbolic (RMS)", \
+         "sched.csv" using ( strcol(2) eq periods ? $3 : NaN ):( $6 / $4 ) with linespoints lw 2 title "WCRT (RMS)", \
+         "sched.csv" using ( strcol(2) eq periods ? $3 : NaN ):( $7 / $4 ) with linespoints lw 2 title "Utilisation (EDF)", \
+         "sched.csv" using ( strcol(2) eq periods ? $3 : NaN ):( $8 / $4 ) with linespoints lw 2 title "Processor Demand (EDF)"
+}
+unset multiplot